@@ -9,6 +9,7 @@
 #include <venom/common/VenomEngine.h>
 #include <venom/common/Log.h>
 #include <venom/common/plugin/graphics/Model.h>
+#include <venom/common/Config.h>
 
 #if defined(_WIN32) && defined(_ANALYSIS)
 #define _DEBUG
@@ -29,14 +30,84 @@ int ReportHook(int reportType, char *message, int * returnValue)
 }
 #endif
 
+#include <cstring>
 #include <thread>
 
+/// @brief Headless options: --headless, --frames=N, --size=WxH, --readback=png|raw, --output=dir
+/// Profiling: --trace=file.json (Chrome trace of the CPU zones)
+/// Pipeline cache: --pipeline-cache=dir (empty to disable persistence)
+/// Baked assets: --bake-dir=dir (empty to always import the source models & textures)
+/// Meshes: --mesh-optimization=none|cache|overdraw (reordering for the GPU's vertex cache, default cache)
+/// LODs: --lod-sizes=a,b,c (projected sizes under which each next LOD is drawn, empty for full detail only), --lod-hysteresis=x
+/// Textures: --no-bindless (one descriptor set per texture even if the device supports descriptor indexing)
+/// @return false on an invalid value, after printing the usage
+static bool ParseArguments(int argc, char** argv)
+{
+    vc::Config * config = vc::Config::GetInstance();
+    for (int i = 1; i < argc; ++i) {
+        const char * arg = argv[i];
+        unsigned int width, height;
+        if (strcmp(arg, "--headless") == 0) {
+            config->SetHeadless(true);
+        } else if (strncmp(arg, "--frames=", 9) == 0) {
+            config->SetMaxFrameCount(strtoull(arg + 9, nullptr, 10));
+        } else if (sscanf(arg, "--size=%ux%u", &width, &height) == 2 && width > 0 && height > 0) {
+            config->SetHeadlessResolution(width, height);
+        } else if (strcmp(arg, "--readback=png") == 0) {
+            config->SetReadbackFormat(vc::Config::ReadbackFormat::PNG);
+        } else if (strcmp(arg, "--readback=raw") == 0) {
+            config->SetReadbackFormat(vc::Config::ReadbackFormat::Raw);
+        } else if (strncmp(arg, "--output=", 9) == 0) {
+            config->SetReadbackOutputPath(arg + 9);
+        } else if (strncmp(arg, "--trace=", 8) == 0) {
+            config->SetTraceOutputPath(arg + 8);
+        } else if (strncmp(arg, "--pipeline-cache=", 17) == 0) {
+            config->SetPipelineCacheDirectory(arg + 17);
+        } else if (strncmp(arg, "--bake-dir=", 11) == 0) {
+            config->SetBakedAssetDirectory(arg + 11);
+        } else if (strcmp(arg, "--mesh-optimization=none") == 0) {
+            config->SetMeshOptimization(vc::Config::MeshOptimization::None);
+        } else if (strcmp(arg, "--mesh-optimization=cache") == 0) {
+            config->SetMeshOptimization(vc::Config::MeshOptimization::VertexCache);
+        } else if (strcmp(arg, "--mesh-optimization=overdraw") == 0) {
+            config->SetMeshOptimization(vc::Config::MeshOptimization::Overdraw);
+        } else if (strncmp(arg, "--lod-sizes=", 12) == 0) {
+            std::vector<float> screenSizes;
+            const char * size = arg + 12;
+            while (*size) {
+                char * end;
+                const float screenSize = strtof(size, &end);
+                if (end == size)
+                    break;
+                // Mesh::SelectLod's hysteresis walks the thresholds in order, each must be under the previous one
+                if (!screenSizes.empty() && screenSize >= screenSizes.back()) {
+                    vc::Log::Error("Usage: --lod-sizes=a,b,c with strictly descending sizes, got %f after %f", screenSize, screenSizes.back());
+                    return false;
+                }
+                screenSizes.emplace_back(screenSize);
+                size = *end == ',' ? end + 1 : end;
+            }
+            config->SetLodScreenSizes(screenSizes);
+        } else if (strncmp(arg, "--lod-hysteresis=", 17) == 0) {
+            config->SetLodHysteresis(strtof(arg + 17, nullptr));
+        } else if (strcmp(arg, "--no-bindless") == 0) {
+            config->SetBindlessTexturesEnabled(false);
+        } else {
+            vc::Log::Print("Unknown argument: %s", arg);
+        }
+    }
+    return true;
+}
+
 int main(int argc, char** argv)
 {
     int errorCode = EXIT_SUCCESS;
 
     printf("hello1\n");
 
+    if (!ParseArguments(argc, argv))
+        return EXIT_FAILURE;
+
 #if defined(_WIN32) && defined(_ANALYSIS)
     // Enable memory leak detection
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
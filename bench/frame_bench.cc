@@ -0,0 +1,122 @@
+///
+/// Project: VenomEngine
+/// @file frame_bench.cc
+/// @date Oct, 16 2026
+/// @brief Runs the engine headless for a fixed number of frames and reports CPU frame time percentiles as JSON.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/VenomEngine.h>
+#include <venom/common/Config.h>
+#include <venom/common/FrameProfiler.h>
+#include <venom/common/Log.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+struct BenchSettings
+{
+    uint64_t frameCount = 1000;
+    uint64_t warmupFrameCount = 100;
+    uint32_t width = 1280;
+    uint32_t height = 720;
+    std::string scene = "eye/eye.obj";
+    // Empty means stdout
+    std::string jsonPath;
+    // Chrome trace of the run, empty for none
+    std::string tracePath;
+};
+
+static bool ParseArguments(int argc, char** argv, BenchSettings & settings)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char * arg = argv[i];
+        if (strncmp(arg, "--frames=", 9) == 0) {
+            settings.frameCount = strtoull(arg + 9, nullptr, 10);
+        } else if (strncmp(arg, "--warmup=", 9) == 0) {
+            settings.warmupFrameCount = strtoull(arg + 9, nullptr, 10);
+        } else if (strncmp(arg, "--size=", 7) == 0) {
+            if (sscanf(arg + 7, "%ux%u", &settings.width, &settings.height) != 2 || settings.width == 0 || settings.height == 0) {
+                vc::Log::Error("Invalid size: %s, expected WxH", arg + 7);
+                return false;
+            }
+        } else if (strncmp(arg, "--scene=", 8) == 0) {
+            settings.scene = arg + 8;
+        } else if (strncmp(arg, "--json=", 7) == 0) {
+            settings.jsonPath = arg + 7;
+        } else if (strncmp(arg, "--trace=", 8) == 0) {
+            settings.tracePath = arg + 8;
+        } else {
+            vc::Log::Error("Unknown argument: %s", arg);
+            vc::Log::Error("Usage: frame_bench [--frames=N] [--warmup=N] [--size=WxH] [--scene=model] [--json=path] [--trace=path]");
+            return false;
+        }
+    }
+    if (settings.frameCount == 0) {
+        vc::Log::Error("--frames must be greater than 0");
+        return false;
+    }
+    return true;
+}
+
+static void WriteStats(FILE * file, const char * name, const vc::FrameTimeStats & stats, const bool last)
+{
+    fprintf(file, "    \"%s\": {\"p50_us\": %.3f, \"p95_us\": %.3f, \"p99_us\": %.3f, \"mean_us\": %.3f, \"max_us\": %.3f}%s\n",
+        name, stats.p50, stats.p95, stats.p99, stats.mean, stats.max, last ? "" : ",");
+}
+
+static bool WriteReport(const BenchSettings & settings)
+{
+    const vc::FrameProfiler * profiler = vc::FrameProfiler::GetInstance();
+    FILE * file = settings.jsonPath.empty() ? stdout : fopen(settings.jsonPath.c_str(), "w");
+    if (!file) {
+        vc::Log::Error("Failed to open %s", settings.jsonPath.c_str());
+        return false;
+    }
+    fprintf(file, "{\n");
+    fprintf(file, "  \"scene\": \"%s\",\n", settings.scene.c_str());
+    fprintf(file, "  \"width\": %u,\n", settings.width);
+    fprintf(file, "  \"height\": %u,\n", settings.height);
+    fprintf(file, "  \"warmup_frames\": %" PRIu64 ",\n", settings.warmupFrameCount);
+    fprintf(file, "  \"frames\": %zu,\n", profiler->GetSamples().size());
+    fprintf(file, "  \"phases\": {\n");
+    for (size_t i = 0; i < static_cast<size_t>(vc::FramePhase::Count); ++i) {
+        const vc::FramePhase phase = static_cast<vc::FramePhase>(i);
+        WriteStats(file, vc::FrameProfiler::GetPhaseName(phase), profiler->ComputePhaseStats(phase), false);
+    }
+    WriteStats(file, "frame", profiler->ComputeFrameStats(), true);
+    fprintf(file, "  }\n");
+    fprintf(file, "}\n");
+    if (file != stdout)
+        fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchSettings settings;
+    if (!ParseArguments(argc, argv, settings))
+        return EXIT_FAILURE;
+
+    // Offscreen rendering, no vsync nor compositor in the measurements
+    vc::Config * config = vc::Config::GetInstance();
+    config->SetHeadless(true);
+    config->SetHeadlessResolution(settings.width, settings.height);
+    config->SetMaxFrameCount(settings.warmupFrameCount + settings.frameCount);
+    config->SetSceneModelPath(settings.scene);
+    config->SetTraceOutputPath(settings.tracePath);
+
+    vc::FrameProfiler::GetInstance()->Enable(settings.frameCount, settings.warmupFrameCount);
+    if (const vc::Error err = vc::VenomEngine::RunEngine(argv); err != vc::Error::Success) {
+        vc::Log::Error("Engine failed: %d", static_cast<int>(err));
+        return EXIT_FAILURE;
+    }
+    vc::FrameProfiler::GetInstance()->Disable();
+
+    if (vc::FrameProfiler::GetInstance()->GetSamples().size() != settings.frameCount) {
+        vc::Log::Error("Only %zu frames out of %" PRIu64 " were recorded", vc::FrameProfiler::GetInstance()->GetSamples().size(), settings.frameCount);
+        return EXIT_FAILURE;
+    }
+    return WriteReport(settings) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
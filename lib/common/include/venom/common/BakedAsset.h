@@ -0,0 +1,41 @@
+///
+/// Project: VenomEngine
+/// @file BakedAsset.h
+/// @date Oct, 16 2026
+/// @brief Naming & hashing shared by every baked asset (models, textures).
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Export.h>
+#include <venom/common/Error.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace venom
+{
+namespace common
+{
+/// @brief Baked copies are named after the content of their source: they are found wherever the source lives
+/// (runfiles, sandboxes, other checkouts) and an edited source simply misses its old bake.
+class VENOM_COMMON_API BakedAsset
+{
+public:
+    /// @brief 64 bits FNV-1a of the file's content
+    static Error HashFile(const std::string & path, uint64_t & hash);
+    /// @brief Folds value into hash (FNV-1a over its bytes), order matters
+    static uint64_t HashCombine(const uint64_t hash, const uint64_t value);
+    /// @return <source stem>-<source hash>.<extension>
+    static std::string GetBakedFileName(const std::string & sourcePath, const uint64_t sourceHash, const char * extension);
+    /// @brief Baked copy in vc::Config's baked asset directory
+    /// @return empty if baking is disabled
+    static std::string GetBakedPath(const std::string & sourcePath, const uint64_t sourceHash, const char * extension);
+    /// @brief Writes to a temporary file renamed over path, a reader never sees a partial bake
+    /// @param chunks (data, size) pairs written one after the other
+    static Error WriteFile(const std::string & path, const std::vector<std::pair<const void *, size_t>> & chunks);
+};
+}
+}
@@ -9,6 +9,9 @@
 
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 
+#include <string>
+#include <vector>
+
 namespace venom
 {
 namespace common
@@ -24,6 +27,83 @@ public:
     static Config * GetInstance();
 public:
     GraphicsPlugin::GraphicsPluginType GetGraphicsPluginType() const;
+    /// @brief Initial size of the persistent staging buffer used for uploads (grows if needed)
+    size_t GetStagingBufferSize() const;
+    void SetStagingBufferSize(const size_t size);
+
+    /// @brief Headless mode: no window nor surface, frames are rendered to offscreen images
+    bool IsHeadless() const;
+    void SetHeadless(const bool headless);
+    /// @brief Size of the offscreen images in headless mode
+    uint32_t GetHeadlessWidth() const;
+    uint32_t GetHeadlessHeight() const;
+    void SetHeadlessResolution(const uint32_t width, const uint32_t height);
+    /// @brief Number of frames before the application closes, 0 for no limit
+    uint64_t GetMaxFrameCount() const;
+    void SetMaxFrameCount(const uint64_t frameCount);
+
+    enum class ReadbackFormat
+    {
+        None,
+        PNG,
+        Raw
+    };
+    /// @brief Format of the frames read back to the readback output directory, in headless mode
+    ReadbackFormat GetReadbackFormat() const;
+    void SetReadbackFormat(const ReadbackFormat format);
+    const std::string & GetReadbackOutputPath() const;
+    void SetReadbackOutputPath(const std::string & path);
+    /// @brief Model loaded in the test scene, relative to the models resources
+    const std::string & GetSceneModelPath() const;
+    void SetSceneModelPath(const std::string & path);
+    /// @brief Chrome trace file the CPU zones are captured to, empty to disable tracing
+    const std::string & GetTraceOutputPath() const;
+    void SetTraceOutputPath(const std::string & path);
+    /// @brief Directory the pipeline cache is loaded from and saved to, empty to keep it in memory only
+    const std::string & GetPipelineCacheDirectory() const;
+    void SetPipelineCacheDirectory(const std::string & path);
+    /// @brief Directory models & textures are baked to on first import and loaded from afterwards, empty to always import the sources
+    const std::string & GetBakedAssetDirectory() const;
+    void SetBakedAssetDirectory(const std::string & path);
+
+    enum class MeshOptimization
+    {
+        None,
+        /// @brief Triangles reordered for the post-transform vertex cache, then vertices for fetch locality
+        VertexCache,
+        /// @brief VertexCache, with triangle clusters sorted to reduce overdraw
+        Overdraw
+    };
+    /// @brief Reordering applied to meshes when imported or baked, bakes of another mode are rebaked
+    MeshOptimization GetMeshOptimization() const;
+    void SetMeshOptimization(const MeshOptimization optimization);
+    /// @brief Projected sizes (bounding sphere diameter over the viewport's height) under which each next LOD is drawn,
+    /// decreasing. Empty to always draw the full detail
+    const std::vector<float> & GetLodScreenSizes() const;
+    void SetLodScreenSizes(const std::vector<float> & screenSizes);
+    /// @brief Relative margin a mesh's projected size must get past a threshold by before its LOD changes
+    float GetLodHysteresis() const;
+    void SetLodHysteresis(const float hysteresis);
+    /// @brief Bindless textures, used only if the device supports descriptor indexing
+    bool IsBindlessTexturesEnabled() const;
+    void SetBindlessTexturesEnabled(const bool enabled);
+
+private:
+    size_t __stagingBufferSize;
+    bool __headless;
+    uint32_t __headlessWidth;
+    uint32_t __headlessHeight;
+    uint64_t __maxFrameCount;
+    ReadbackFormat __readbackFormat;
+    std::string __readbackOutputPath;
+    std::string __sceneModelPath;
+    std::string __traceOutputPath;
+    std::string __pipelineCacheDirectory;
+    std::string __bakedAssetDirectory;
+    MeshOptimization __meshOptimization;
+    std::vector<float> __lodScreenSizes;
+    float __lodHysteresis;
+    bool __bindlessTextures;
 };
 }
 }
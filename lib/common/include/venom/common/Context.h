@@ -22,7 +22,9 @@ public:
     Context();
     ~Context();
 public:
+    /// @brief Creates the window, or nothing in headless mode (see Config::IsHeadless())
     Error InitContext();
+    bool IsHeadless() const;
     bool ShouldClose();
     void PollEvents();
     GLFWwindow * GetWindow();
@@ -30,6 +32,7 @@ public:
 
 private:
     GLFWwindow * __window;
+    bool __glfwInitialized;
     std::vector<GLFWvidmode> __modes;
 };
 }
@@ -0,0 +1,93 @@
+///
+/// Project: VenomEngine
+/// @file FrameProfiler.h
+/// @date Oct, 16 2026
+/// @brief Per frame CPU timings of the main loop phases.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Timer.h>
+
+#include <vector>
+
+namespace venom
+{
+namespace common
+{
+enum class FramePhase
+{
+    Poll,
+    Record,
+    Submit,
+    Present,
+    Count
+};
+
+/// @brief Times of the phases of one frame, in nanoseconds
+struct FrameSample
+{
+    uint64_t phases[static_cast<size_t>(FramePhase::Count)];
+    uint64_t total;
+};
+
+/// @brief Statistics over the recorded frames, in microseconds
+struct FrameTimeStats
+{
+    double p50;
+    double p95;
+    double p99;
+    double mean;
+    double max;
+};
+
+/// @brief Records FrameSamples when enabled, the graphics application times its phases with it.
+/// Disabled by default: nothing is stored and the cost is a branch per phase.
+class VENOM_COMMON_API FrameProfiler
+{
+private:
+    FrameProfiler();
+public:
+    ~FrameProfiler();
+    static FrameProfiler * GetInstance();
+
+    /// @param warmupFrameCount first frames that are not recorded (pipeline creation, uploads, ...)
+    void Enable(const size_t expectedFrameCount, const size_t warmupFrameCount = 0);
+    void Disable();
+    bool IsEnabled() const;
+
+    void BeginFrame();
+    /// @brief Adds time to the phase of the current frame (a phase may be timed several times per frame)
+    void AddPhaseTime(const FramePhase phase, const uint64_t nanoseconds);
+    void EndFrame();
+
+    const std::vector<FrameSample> & GetSamples() const;
+    FrameTimeStats ComputePhaseStats(const FramePhase phase) const;
+    FrameTimeStats ComputeFrameStats() const;
+    static const char * GetPhaseName(const FramePhase phase);
+
+private:
+    FrameTimeStats __ComputeStats(std::vector<uint64_t> & values) const;
+
+private:
+    std::vector<FrameSample> __samples;
+    FrameSample __currentSample;
+    Timer __frameTimer;
+    size_t __warmupFrameCount;
+    size_t __frameCount;
+    bool __enabled;
+};
+
+/// @brief Times its scope into the given phase
+class VENOM_COMMON_API FramePhaseScope
+{
+public:
+    explicit FramePhaseScope(const FramePhase phase);
+    ~FramePhaseScope();
+
+private:
+    Timer __timer;
+    const FramePhase __phase;
+};
+}
+}
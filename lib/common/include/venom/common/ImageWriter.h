@@ -0,0 +1,29 @@
+///
+/// Project: VenomEngine
+/// @file ImageWriter.h
+/// @date Oct, 16 2026
+/// @brief Writes pixel data to disk (frame captures, readbacks).
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Error.h>
+
+#include <cstdint>
+
+namespace venom
+{
+namespace common
+{
+class VENOM_COMMON_API ImageWriter
+{
+public:
+    /// @param rowPitch size of a row in bytes, may be larger than width * channels
+    static Error WritePNG(const char * path, const uint32_t width, const uint32_t height, const uint32_t channels,
+        const void * data, const size_t rowPitch);
+    /// @brief Dumps the bytes as they are, rows tightly packed
+    static Error WriteRaw(const char * path, const uint32_t width, const uint32_t height, const uint32_t channels,
+        const void * data, const size_t rowPitch);
+};
+}
+}
@@ -0,0 +1,47 @@
+///
+/// Project: VenomEngine
+/// @file MappedFile.h
+/// @date Oct, 16 2026
+/// @brief Read only memory mapping of a whole file.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Export.h>
+#include <venom/common/Error.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace venom
+{
+namespace common
+{
+/// @brief Pages are only read from disk when touched, the data stays valid until Close() or destruction
+class VENOM_COMMON_API MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    Error Open(const std::string & path);
+    void Close();
+
+    bool IsOpen() const;
+    const uint8_t * GetData() const;
+    size_t GetSize() const;
+
+private:
+    const uint8_t * __data;
+    size_t __size;
+#ifdef _WIN32
+    void * __mapping;
+#endif
+};
+}
+}
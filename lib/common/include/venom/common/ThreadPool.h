@@ -0,0 +1,75 @@
+///
+/// Project: VenomEngine
+/// @file ThreadPool.h
+/// @date Oct, 16 2026
+/// @brief Fixed size pool of worker threads for engine jobs.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Export.h>
+#include <venom/common/Error.h>
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace venom
+{
+namespace common
+{
+class VENOM_COMMON_API ThreadPool
+{
+public:
+    /// @param threadCount number of workers, 0 means hardware concurrency - 1 (at least 1)
+    explicit ThreadPool(uint32_t threadCount = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief Queues a job
+    /// @return future holding the job's result
+    template<typename Function>
+    auto Submit(Function && function) -> std::future<decltype(function())>
+    {
+        using ReturnType = decltype(function());
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Function>(function));
+        std::future<ReturnType> future = task->get_future();
+        __Enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /// @brief Splits [0, count) in contiguous ranges of at least minBatchSize elements, runs them on the workers and
+    /// the calling thread, then blocks until all of them are done. The calling thread runs every batch no worker
+    /// started, so busy workers slow it down but never block it.
+    /// @param function called with (begin, end, batchIndex)
+    /// @return number of batches used
+    size_t ParallelFor(const size_t count, const size_t minBatchSize, const std::function<void(size_t, size_t, size_t)> & function);
+
+    uint32_t GetThreadCount() const;
+    /// @return index of the calling thread among this pool's workers, -1 if it isn't one of them
+    int32_t GetWorkerIndex() const;
+
+    /// @brief Pool shared by the whole engine
+    static ThreadPool * GetGlobalThreadPool();
+
+private:
+    void __Enqueue(std::function<void()> && job);
+    void __WorkerLoop(const uint32_t workerIndex);
+
+private:
+    std::vector<std::thread> __workers;
+    std::queue<std::function<void()>> __jobs;
+    std::mutex __mutex;
+    std::condition_variable __condition;
+    bool __stopping;
+};
+}
+}
@@ -0,0 +1,83 @@
+///
+/// Project: VenomEngine
+/// @file Trace.h
+/// @date Oct, 16 2026
+/// @brief Scoped CPU zones written to a Chrome trace (JSON) file.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Error.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace venom
+{
+namespace common
+{
+/// @brief One completed zone, names must outlive the capture (string literals, __FUNCTION__)
+struct TraceEvent
+{
+    const char * name;
+    uint64_t begin;
+    uint64_t end;
+};
+
+/// @brief Zones are pushed into a ring buffer owned by the thread recording them (single producer, no lock),
+/// drained by Flush() (single consumer) into the trace file. Zones are dropped if a buffer is full between two flushes.
+/// The output is the Chrome trace event format, readable by chrome://tracing and ui.perfetto.dev.
+class VENOM_COMMON_API Trace
+{
+public:
+    /// @brief Starts capturing zones into path
+    static Error Begin(const char * path);
+    /// @brief Drains every thread's buffer into the file, cheap when nothing was recorded. To call once per frame.
+    static void Flush();
+    /// @brief Flushes and closes the file
+    static void End();
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /// @brief Name shown for the calling thread, must outlive the capture. Only recorded, cheap when tracing is off
+    static void SetThreadName(const char * name);
+    /// @brief Nanoseconds since an arbitrary epoch shared by every thread
+    static uint64_t Now();
+    static void Push(const TraceEvent & event);
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+class VENOM_COMMON_API TraceZone
+{
+public:
+    explicit TraceZone(const char * name)
+        : __name(name)
+        , __begin(Trace::IsEnabled() ? Trace::Now() : 0)
+    {
+    }
+    ~TraceZone()
+    {
+        if (__begin != 0 && Trace::IsEnabled())
+            Trace::Push({__name, __begin, Trace::Now()});
+    }
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+    const char * __name;
+    const uint64_t __begin;
+};
+}
+}
+
+#ifndef VENOM_DISABLE_TRACE
+#define VENOM_TRACE_CONCAT_IMPL(a, b) a##b
+#define VENOM_TRACE_CONCAT(a, b) VENOM_TRACE_CONCAT_IMPL(a, b)
+/// @brief Records the enclosing scope as a zone named name
+#define VENOM_TRACE_ZONE(name) ::venom::common::TraceZone VENOM_TRACE_CONCAT(__venomTraceZone, __LINE__)(name)
+#define VENOM_TRACE_FUNCTION() VENOM_TRACE_ZONE(__FUNCTION__)
+#else
+#define VENOM_TRACE_ZONE(name)
+#define VENOM_TRACE_FUNCTION()
+#endif
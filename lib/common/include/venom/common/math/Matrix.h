@@ -29,6 +29,10 @@ VENOM_COMMON_API Mat4 Identity();
 /// @param axis normalized
 /// @param angle in radians
 VENOM_COMMON_API void RotateMatrix(Mat4& matrix, const Vec3& axis, const float angle);
+/// @brief Transforms a point (w = 1)
+VENOM_COMMON_API Vec3 TransformPoint(const Mat4& matrix, const Vec3& point);
+/// @brief Largest scale along the matrix's axes
+VENOM_COMMON_API float GetMaxScale(const Mat4& matrix);
 VENOM_COMMON_API Mat4 LookAtLH(const Vec3& eye, const Vec3& center, const Vec3& up);
 VENOM_COMMON_API Mat4 LookAtRH(const Vec3& eye, const Vec3& center, const Vec3& up);
 inline Mat4 LookAt(const Vec3& eye, const Vec3& center, const Vec3& up)
@@ -31,11 +31,13 @@ public:
 
 protected:
     Plugin(const PluginType type);
+    /// @brief Destroys the objects removed since the last call, called once per frame.
+    /// Overridden by plugins that need to release GPU resources once they're no longer in use.
+    virtual void CleanPluginObjects();
 
 private:
     void AddPluginObject(PluginObject * object);
     void RemovePluginObject(PluginObject * object);
-    void CleanPluginObjects();
 
 private:
     const PluginType __type;
@@ -0,0 +1,179 @@
+///
+/// Project: VenomEngine
+/// @file BakedModel.h
+/// @date Oct, 16 2026
+/// @brief Versioned binary container of an imported model, memory mapped on load.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/MappedFile.h>
+#include <venom/common/plugin/graphics/Mesh.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace venom
+{
+namespace common
+{
+/// @brief File layout, native endianness. Every table and stream starts on a BAKED_MODEL_ALIGNMENT boundary,
+/// vertex streams are stored exactly as they are uploaded (one tightly packed stream per binding).
+struct BakedModelHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    /// @brief Hash of the source file the model was baked from
+    uint64_t sourceHash;
+    /// @brief Hashes of the other files the importer read (materials, buffers) folded in table order, 0 if none
+    uint64_t dependencyHash;
+    uint32_t streamStrides[static_cast<uint32_t>(VertexStream::Count)];
+    uint32_t meshCount;
+    uint32_t materialCount;
+    uint32_t componentCount;
+    uint32_t textureCount;
+    /// @brief Config::MeshOptimization the meshes were baked with
+    uint32_t meshOptimization;
+    uint32_t dependencyCount;
+    uint64_t meshesOffset;
+    uint64_t materialsOffset;
+    uint64_t componentsOffset;
+    uint64_t texturesOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t dependenciesOffset;
+};
+
+struct BakedMesh
+{
+    uint32_t materialIndex;
+    uint32_t vertexCount;
+    /// @brief Of every LOD
+    uint32_t indexCount;
+    uint32_t lodCount;
+    /// @brief 0 if the stream is absent
+    uint64_t streamOffsets[static_cast<uint32_t>(VertexStream::Count)];
+    uint64_t indicesOffset;
+    /// @brief Table of lodCount MeshLod
+    uint64_t lodsOffset;
+};
+
+struct BakedMaterial
+{
+    uint32_t nameOffset;
+    uint32_t nameSize;
+    uint32_t firstComponent;
+    uint32_t componentCount;
+};
+
+struct BakedMaterialComponent
+{
+    /// @brief MaterialComponentType
+    uint32_t type;
+    /// @brief MaterialComponentValueType
+    uint32_t valueType;
+    /// @brief Color or value (first float), unused for textures
+    float value[4];
+    /// @brief Index in the texture table, for textures only
+    uint32_t textureIndex;
+    uint32_t padding;
+};
+
+struct BakedTexture
+{
+    /// @brief Path relative to the source model's folder
+    uint32_t pathOffset;
+    uint32_t pathSize;
+};
+
+struct BakedDependency
+{
+    /// @brief Path relative to the source model's folder
+    uint32_t pathOffset;
+    uint32_t pathSize;
+};
+
+constexpr uint32_t BAKED_MODEL_MAGIC = 0x424D4E56; // "VNMB"
+/// @brief To bump on any layout change, older bakes are then rebaked
+constexpr uint32_t BAKED_MODEL_VERSION = 4;
+constexpr uint64_t BAKED_MODEL_ALIGNMENT = 16;
+constexpr const char * BAKED_MODEL_EXTENSION = "vbake";
+
+/// @brief Gathers a model while it is imported then writes it in one go
+class VENOM_COMMON_API BakedModelWriter
+{
+public:
+    BakedModelWriter();
+    ~BakedModelWriter();
+
+    /// @return index of the material
+    uint32_t AddMaterial();
+    void SetMaterialName(const uint32_t material, const std::string & name);
+    /// @param value 3 or 4 floats for colors, 1 for values
+    void AddMaterialValue(const uint32_t material, const MaterialComponentType type, const MaterialComponentValueType valueType, const float * value);
+    /// @param path relative to the source model's folder, shared between materials
+    void AddMaterialTexture(const uint32_t material, const MaterialComponentType type, const std::string & path);
+    /// @brief The streams aren't copied, they must stay valid until Write()
+    void AddMesh(const uint32_t material, const MeshStreams & streams);
+    /// @brief File read along with the source, the bake is stale once its content changes
+    /// @param path relative to the source model's folder
+    void AddDependency(const std::string & path, const uint64_t hash);
+
+    Error Write(const std::string & path, const uint64_t sourceHash) const;
+
+private:
+    uint32_t __AddString(const std::string & str);
+
+private:
+    struct PendingMaterial
+    {
+        BakedMaterial material;
+        std::vector<BakedMaterialComponent> components;
+    };
+    std::vector<PendingMaterial> __materials;
+    std::vector<BakedMesh> __meshes;
+    std::vector<MeshStreams> __meshStreams;
+    std::vector<BakedTexture> __textures;
+    std::vector<std::string> __texturePaths;
+    std::vector<BakedDependency> __dependencies;
+    uint64_t __dependencyHash;
+    std::string __strings;
+};
+
+/// @brief Read only view of a mapped baked model, every accessor points into the mapping
+class VENOM_COMMON_API BakedModel
+{
+public:
+    BakedModel();
+    ~BakedModel();
+    BakedModel(const BakedModel&) = delete;
+    BakedModel& operator=(const BakedModel&) = delete;
+
+    /// @brief Maps the file, validates every table against its size and hashes the source's dependencies
+    /// @param sourcePath dependencies are found relative to its folder
+    /// @return Error::Failure if missing, corrupted, of another version, baked from another source or dependency,
+    /// or with another mesh optimization
+    Error Open(const std::string & path, const std::string & sourcePath, const uint64_t sourceHash);
+
+    uint32_t GetMeshCount() const;
+    const BakedMesh & GetMesh(const uint32_t index) const;
+    /// @brief Streams of the mesh, straight from the mapping
+    MeshStreams GetMeshStreams(const uint32_t index) const;
+    uint32_t GetMaterialCount() const;
+    std::string_view GetMaterialName(const uint32_t index) const;
+    const BakedMaterialComponent * GetMaterialComponents(const uint32_t index, uint32_t & count) const;
+    uint32_t GetTextureCount() const;
+    std::string_view GetTexturePath(const uint32_t index) const;
+
+private:
+    template<typename T>
+    const T * __At(const uint64_t offset) const { return reinterpret_cast<const T *>(__file.GetData() + offset); }
+    bool __IsInFile(const uint64_t offset, const uint64_t size) const;
+
+private:
+    MappedFile __file;
+    const BakedModelHeader * __header;
+};
+}
+}
@@ -92,7 +92,9 @@ public:
      */
     void SetValue(const Texture * texture);
 
+    /// @brief nullptr if the value isn't a texture
     const Texture * GetTexture() const;
+    MaterialComponentValueType GetValueType() const;
 private:
     const MaterialComponentType __type;
     MaterialComponentValueType __valueType;
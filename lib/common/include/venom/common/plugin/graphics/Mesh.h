@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/common/math/Vector.h>
+#include <venom/common/math/Matrix.h>
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 
 #include <venom/common/plugin/graphics/Material.h>
@@ -19,6 +20,78 @@ namespace venom
 namespace common
 {
 class Model;
+
+/// @brief Vertex attributes uploaded to the Graphics API, in the order of their vertex buffer bindings
+enum class VertexStream : uint32_t
+{
+    Position,
+    Normal,
+    Color,
+    UV,
+    Tangent,
+    Bitangent,
+    Count
+};
+
+/// @brief Size of one vertex of the stream
+constexpr uint32_t VERTEX_STREAM_STRIDES[static_cast<uint32_t>(VertexStream::Count)] = {
+    sizeof(vcm::VertexPos),
+    sizeof(vcm::VertexNormal),
+    sizeof(vcm::VertexColor),
+    sizeof(vcm::VertexUV),
+    sizeof(vcm::VertexTangent),
+    sizeof(vcm::VertexBitangent)
+};
+
+/// @brief Range of the index buffer drawing one level of detail, every LOD shares the mesh's vertices
+struct MeshLod
+{
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    /// @brief Simplification error, relative to the mesh's size (0 for the full detail)
+    float error;
+};
+
+constexpr uint32_t MAX_MESH_LOD_COUNT = 4;
+
+/// @brief Camera LODs are selected for
+struct LodView
+{
+    vcm::Vec3 cameraPosition;
+    /// @brief 1 / tan(vertical fov / 2) of the projection
+    float projectionScale;
+};
+
+/// @brief Non owning view of the data uploaded for a mesh, nullptr streams are absent
+struct MeshStreams
+{
+    const void * streams[static_cast<uint32_t>(VertexStream::Count)] = {};
+    uint32_t vertexCount = 0;
+    /// @brief Indices of every LOD, one after the other
+    const uint32_t * indices = nullptr;
+    uint32_t indexCount = 0;
+    /// @brief Finest first, none means a single LOD of every index
+    const MeshLod * lods = nullptr;
+    uint32_t lodCount = 0;
+};
+
+/// @brief CPU side attributes & indices of a mesh, independent of the Graphics API
+struct VENOM_COMMON_API MeshData
+{
+    std::vector<vcm::VertexPos> positions;
+    std::vector<vcm::VertexNormal> normals;
+    std::vector<vcm::VertexColor> colors[8];
+    std::vector<vcm::VertexUV> uvs[8];
+    std::vector<uint32_t> indices;
+    std::vector<vcm::VertexTangent> tangents;
+    std::vector<vcm::VertexBitangent> bitangents;
+    /// @brief Ranges of indices, empty until generated (see MeshOptimizer::GenerateLods())
+    std::vector<MeshLod> lods;
+
+    /// @brief Streams uploaded for the mesh (first color & UV sets only)
+    MeshStreams GetStreams() const;
+};
+
 /// @brief Contains all the mesh's data and is the
 /// main high-level interface for the user
 class VENOM_COMMON_API Mesh : public GraphicsPluginObject
@@ -40,24 +113,51 @@ public:
 
     const Material * GetMaterial() const;
 
+    /// @brief LOD 0 being the full detail, 0 for meshes without indices
+    uint32_t GetLodCount() const;
+    const MeshLod & GetLod(const uint32_t lod) const;
+    /// @brief Bounding sphere of the positions, in model space
+    const vcm::Vec3 & GetBoundingSphereCenter() const;
+    float GetBoundingSphereRadius() const;
+    /// @brief Projected diameter of the bounding sphere over the viewport's height, as given to SelectLod()
+    float GetScreenSize(const vcm::Mat4 & transform, const LodView & view) const;
+    /**
+     * @brief Picks the LOD to draw from the mesh's projected size, the thresholds of vc::Config being widened by its
+     * hysteresis around the last pick so a mesh hovering around a threshold doesn't pop back and forth
+     * Not thread safe, to call once per frame before recording the draws
+     * @param screenSize bounding sphere's projected diameter over the viewport's height
+     */
+    uint32_t SelectLod(const float screenSize);
+    /// @brief Last LOD returned by SelectLod()
+    uint32_t GetSelectedLod() const;
+
 private:
+    /**
+     * @brief Keeps the LODs & bounds of the streams, then loads them into the Graphics API
+     * @return vc::Error::Failure if the loading failed, vc::Error::Success otherwise
+     */
+    vc::Error __LoadMesh(const MeshStreams & streams);
     /**
      * @brief Loads Mesh into the Graphics API from the current data
      * So it is expected that vertices, faces, ... are loaded in the Mesh beforehand
      * @return vc::Error::Failure if the loading failed, vc::Error::Success otherwise
      */
-    virtual vc::Error __LoadMeshFromCurrentData() = 0;
+    vc::Error __LoadMeshFromCurrentData();
+    /**
+     * @brief Loads Mesh into the Graphics API straight from the streams (e.g. a mapped baked model)
+     * The streams only need to outlive the call
+     * @return vc::Error::Failure if the loading failed, vc::Error::Success otherwise
+     */
+    virtual vc::Error __LoadMeshFromStreams(const MeshStreams & streams) = 0;
 
 protected:
     friend class Model;
-    std::vector<vcm::VertexPos> __positions;
-    std::vector<vcm::VertexNormal> __normals;
-    std::vector<vcm::VertexColor> __colors[8];
-    std::vector<vcm::VertexUV> __uvs[8];
-    std::vector<uint32_t> __indices;
-    std::vector<vcm::VertexTangent> __tangents;
-    std::vector<vcm::VertexBitangent> __bitangents;
+    MeshData __data;
     Material * __material;
+    std::vector<MeshLod> __lods;
+    vcm::Vec3 __boundingSphereCenter;
+    float __boundingSphereRadius;
+    uint32_t __selectedLod;
 };
 
 
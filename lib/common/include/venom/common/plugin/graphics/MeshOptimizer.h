@@ -0,0 +1,64 @@
+///
+/// Project: VenomEngine
+/// @file MeshOptimizer.h
+/// @date Oct, 16 2026
+/// @brief CPU passes reordering mesh indices & vertices for the GPU's vertex caches and overdraw, and generating LODs.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Mesh.h>
+
+namespace venom
+{
+namespace common
+{
+/// @brief Post-transform vertex cache efficiency of an index buffer
+struct VertexCacheStatistics
+{
+    /// @brief Vertices shaded, every cache miss
+    uint32_t transformedVertexCount;
+    /// @brief Average cache miss ratio: transformed vertices per triangle, 0.5 at best, 3 at worst
+    float acmr;
+    /// @brief Average transform to vertex ratio: transformed vertices per referenced vertex, 1 at best
+    float atvr;
+};
+
+/// @brief Every pass works on triangle lists, the reordering ones keep the rendered triangles & their winding, only their order changes
+class VENOM_COMMON_API MeshOptimizer
+{
+public:
+    /// @brief FIFO size of the simulated cache, conservative for current GPUs
+    static constexpr uint32_t DEFAULT_CACHE_SIZE = 16;
+    /// @brief How much the cache efficiency may degrade for better overdraw
+    static constexpr float DEFAULT_OVERDRAW_THRESHOLD = 1.05f;
+    /// @brief Meshes with less triangles aren't worth simplifying, and no LOD goes under it
+    static constexpr uint32_t MIN_LOD_TRIANGLE_COUNT = 64;
+
+    /// @brief Simulates a FIFO post-transform cache over the indices
+    static VertexCacheStatistics AnalyzeVertexCache(const uint32_t * indices, const size_t indexCount, const uint32_t vertexCount,
+        const uint32_t cacheSize = DEFAULT_CACHE_SIZE);
+    /// @brief Reorders triangles so consecutive ones share vertices (Forsyth's linear-speed vertex cache optimization)
+    static void OptimizeVertexCache(uint32_t * indices, const size_t indexCount, const uint32_t vertexCount);
+    /// @brief Sorts clusters of cache optimized triangles so outward facing ones are drawn first, splitting the order only
+    /// where the cluster's ACMR stays within threshold of the whole mesh's. To run after OptimizeVertexCache()
+    static void OptimizeOverdraw(uint32_t * indices, const size_t indexCount, const vcm::VertexPos * positions, const uint32_t vertexCount,
+        const float threshold = DEFAULT_OVERDRAW_THRESHOLD);
+    /// @brief Renumbers vertices in the order the indices first reference them, in every stream, dropping unreferenced ones
+    static void OptimizeVertexFetch(MeshData & data);
+
+    /// @brief Runs the vertex cache, (optionally) overdraw then vertex fetch passes on data
+    static void Optimize(MeshData & data, const bool overdraw);
+
+    /// @brief Vertex clustering: the vertices of each cell of a uniform grid collapse into the one closest to the cell's mean,
+    /// the grid's resolution being searched for the most triangles within targetIndexCount. Kept vertices are untouched,
+    /// so result indexes the same vertex buffer (attribute seams inside a cell are merged, fine at a distance)
+    /// @param error set to the cell size over the mesh's size
+    static void SimplifyClustered(const uint32_t * indices, const size_t indexCount, const vcm::VertexPos * positions, const uint32_t vertexCount,
+        const size_t targetIndexCount, std::vector<uint32_t> & result, float & error);
+    /// @brief Sets data's LODs: the current indices as LOD 0, then up to MAX_MESH_LOD_COUNT - 1 coarser ones appended to the
+    /// indices, each with at most half the triangles of the previous one. To run after Optimize(), every LOD shares the vertices
+    static void GenerateLods(MeshData & data, const bool optimizeVertexCache);
+};
+}
+}
@@ -17,6 +17,9 @@ namespace venom
 {
 namespace common
 {
+class BakedModel;
+class BakedModelWriter;
+
 /// @brief Contains all the mesh's data and is the
 /// main high-level interface for the user
 class VENOM_COMMON_API Model : public GraphicsPluginObject
@@ -33,6 +36,16 @@ public:
 
     const std::vector<vc::Mesh *> & GetMeshes() const;
 
+    /// @brief Converts a source model to the baked format without touching the Graphics API (e.g. from tools/venom_bake)
+    static vc::Error BakeModel(const std::string & sourcePath, const std::string & bakedPath, const uint64_t sourceHash);
+
+private:
+    /// @brief Imports through Assimp
+    /// @param writer gathers the model to bake, nullptr if not baking
+    vc::Error __ImportSourceModel(const std::string & path, BakedModelWriter * writer);
+    /// @brief Uploads the baked model straight from its mapping
+    vc::Error __ImportBakedModel(const std::string & path, const BakedModel & baked);
+
 protected:
     std::vector<vc::Mesh *> __meshes;
     std::vector<vc::Material *> __materials;
@@ -8,12 +8,31 @@
 #pragma once
 
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
+#include <venom/common/MappedFile.h>
+
+#include <memory>
 
 namespace venom
 {
 namespace common
 {
 
+/// @brief RGBA8 pixels decoded from an image file, CPU only
+struct VENOM_COMMON_API DecodedImage
+{
+    /// @brief Points into decodedPixels or mapping
+    const unsigned char * pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    /// @brief Owns the pixels decoded from the source
+    std::unique_ptr<unsigned char, void(*)(void *)> decodedPixels{nullptr, nullptr};
+    /// @brief Owns the pixels of a baked image
+    MappedFile mapping;
+};
+
+constexpr const char * BAKED_TEXTURE_EXTENSION = "vtex";
+
 class VENOM_COMMON_API Texture : public GraphicsPluginObject
 {
 protected:
@@ -23,11 +42,29 @@ public:
 
     static Texture * CreateRawTexture();
     static Texture * Create(const std::string & path);
+    /**
+     * @brief Decodes an image file without touching the Graphics API nor the cache, safe to call from any thread
+     * The baked copy is mapped instead if up to date, otherwise it is written once decoded (see vc::Config)
+     * @param path resolved path, as returned by Resources::GetTexturesResourcePath()
+     */
+    static vc::Error DecodeImageFile(const std::string & path, DecodedImage & image);
+    /// @brief Decodes the source to its baked RGBA8 copy without touching the Graphics API (e.g. from tools/venom_bake)
+    static vc::Error BakeImageFile(const std::string & sourcePath, const std::string & bakedPath, const uint64_t sourceHash);
+    /**
+     * @brief Maps a baked image, fails if it is not a baked image of the current version made from sourceHash
+     * Does not touch the Graphics API (e.g. from tools/venom_bake to skip up to date bakes)
+     */
+    static vc::Error OpenBakedImage(const std::string & bakedPath, const uint64_t sourceHash, DecodedImage & image);
+    /**
+     * @brief Creates the texture of an image decoded by DecodeImageFile() and caches it under its path
+     * @return the cached texture if one was created meanwhile, nullptr on failure
+     */
+    static Texture * CreateFromDecodedImage(const std::string & path, const DecodedImage & image);
 
     vc::Error LoadImageFromFile(const char * path);
     vc::Error InitDepthBuffer(int width, int height);
 
-    virtual vc::Error __LoadImage(unsigned char * pixels, int width, int height, int channels) = 0;
+    virtual vc::Error __LoadImage(const unsigned char * pixels, int width, int height, int channels) = 0;
     virtual vc::Error __InitDepthBuffer(int width, int height) = 0;
 protected:
 
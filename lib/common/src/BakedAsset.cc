@@ -0,0 +1,88 @@
+///
+/// Project: VenomEngine
+/// @file BakedAsset.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/BakedAsset.h>
+#include <venom/common/Config.h>
+#include <venom/common/Log.h>
+#include <venom/common/MappedFile.h>
+#include <venom/common/Trace.h>
+
+#include <cinttypes>
+#include <filesystem>
+#include <fstream>
+
+namespace venom
+{
+namespace common
+{
+Error BakedAsset::HashFile(const std::string& path, uint64_t& hash)
+{
+    VENOM_TRACE_FUNCTION();
+    MappedFile file;
+    if (file.Open(path) != Error::Success)
+        return Error::Failure;
+    // FNV-1a
+    hash = 14695981039346656037ull;
+    const uint8_t * data = file.GetData();
+    for (size_t i = 0; i < file.GetSize(); ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return Error::Success;
+}
+
+uint64_t BakedAsset::HashCombine(const uint64_t hash, const uint64_t value)
+{
+    uint64_t combined = hash;
+    for (size_t i = 0; i < sizeof(value); ++i) {
+        combined ^= (value >> (i * 8)) & 0xFF;
+        combined *= 1099511628211ull;
+    }
+    return combined;
+}
+
+std::string BakedAsset::GetBakedFileName(const std::string& sourcePath, const uint64_t sourceHash, const char* extension)
+{
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016" PRIx64, sourceHash);
+    return std::filesystem::path(sourcePath).stem().string() + "-" + hash + "." + extension;
+}
+
+std::string BakedAsset::GetBakedPath(const std::string& sourcePath, const uint64_t sourceHash, const char* extension)
+{
+    const std::string & directory = Config::GetInstance()->GetBakedAssetDirectory();
+    if (directory.empty())
+        return {};
+    return (std::filesystem::path(directory) / GetBakedFileName(sourcePath, sourceHash, extension)).string();
+}
+
+Error BakedAsset::WriteFile(const std::string& path, const std::vector<std::pair<const void *, size_t>>& chunks)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        for (const auto & [data, size] : chunks)
+            file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        if (!file) {
+            Log::Error("Failed to write baked asset: %s", tmpPath.c_str());
+            file.close();
+            std::filesystem::remove(tmpPath, ec);
+            return Error::Failure;
+        }
+    }
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        Log::Error("Failed to write baked asset: %s (%s)", path.c_str(), ec.message().c_str());
+        std::filesystem::remove(tmpPath, ec);
+        return Error::Failure;
+    }
+    return Error::Success;
+}
+}
+}
@@ -0,0 +1,356 @@
+///
+/// Project: VenomEngine
+/// @file BakedModel.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/plugin/graphics/BakedModel.h>
+#include <venom/common/BakedAsset.h>
+#include <venom/common/Config.h>
+#include <venom/common/Log.h>
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <filesystem>
+
+namespace venom
+{
+namespace common
+{
+static constexpr uint32_t STREAM_COUNT = static_cast<uint32_t>(VertexStream::Count);
+
+static uint64_t AlignUp(const uint64_t value)
+{
+    return (value + BAKED_MODEL_ALIGNMENT - 1) / BAKED_MODEL_ALIGNMENT * BAKED_MODEL_ALIGNMENT;
+}
+
+BakedModelWriter::BakedModelWriter()
+    : __dependencyHash(0)
+{
+}
+
+BakedModelWriter::~BakedModelWriter()
+{
+}
+
+uint32_t BakedModelWriter::AddMaterial()
+{
+    __materials.emplace_back().material = {};
+    return static_cast<uint32_t>(__materials.size() - 1);
+}
+
+void BakedModelWriter::SetMaterialName(const uint32_t material, const std::string& name)
+{
+    venom_assert(material < __materials.size(), "Material out of range");
+    __materials[material].material.nameOffset = __AddString(name);
+    __materials[material].material.nameSize = static_cast<uint32_t>(name.size());
+}
+
+void BakedModelWriter::AddMaterialValue(const uint32_t material, const MaterialComponentType type, const MaterialComponentValueType valueType, const float* value)
+{
+    venom_assert(material < __materials.size(), "Material out of range");
+    BakedMaterialComponent component{};
+    component.type = type;
+    component.valueType = valueType;
+    const size_t valueCount = valueType == MaterialComponentValueType::COLOR4D ? 4 : (valueType == MaterialComponentValueType::COLOR3D ? 3 : 1);
+    memcpy(component.value, value, valueCount * sizeof(float));
+    __materials[material].components.emplace_back(component);
+}
+
+void BakedModelWriter::AddMaterialTexture(const uint32_t material, const MaterialComponentType type, const std::string& path)
+{
+    venom_assert(material < __materials.size(), "Material out of range");
+    auto it = std::find(__texturePaths.begin(), __texturePaths.end(), path);
+    if (it == __texturePaths.end()) {
+        __textures.push_back({__AddString(path), static_cast<uint32_t>(path.size())});
+        it = __texturePaths.insert(__texturePaths.end(), path);
+    }
+    BakedMaterialComponent component{};
+    component.type = type;
+    component.valueType = MaterialComponentValueType::TEXTURE;
+    component.textureIndex = static_cast<uint32_t>(it - __texturePaths.begin());
+    __materials[material].components.emplace_back(component);
+}
+
+void BakedModelWriter::AddMesh(const uint32_t material, const MeshStreams& streams)
+{
+    BakedMesh & mesh = __meshes.emplace_back();
+    memset(&mesh, 0, sizeof(BakedMesh));
+    mesh.materialIndex = material;
+    mesh.vertexCount = streams.vertexCount;
+    mesh.indexCount = streams.indices ? streams.indexCount : 0;
+    mesh.lodCount = streams.lods ? streams.lodCount : 0;
+    __meshStreams.emplace_back(streams);
+}
+
+void BakedModelWriter::AddDependency(const std::string& path, const uint64_t hash)
+{
+    __dependencies.push_back({__AddString(path), static_cast<uint32_t>(path.size())});
+    __dependencyHash = BakedAsset::HashCombine(__dependencyHash, hash);
+}
+
+uint32_t BakedModelWriter::__AddString(const std::string& str)
+{
+    const uint32_t offset = static_cast<uint32_t>(__strings.size());
+    __strings += str;
+    return offset;
+}
+
+Error BakedModelWriter::Write(const std::string& path, const uint64_t sourceHash) const
+{
+    VENOM_TRACE_FUNCTION();
+    BakedModelHeader header{};
+    header.magic = BAKED_MODEL_MAGIC;
+    header.version = BAKED_MODEL_VERSION;
+    header.sourceHash = sourceHash;
+    header.dependencyHash = __dependencyHash;
+    header.meshOptimization = static_cast<uint32_t>(Config::GetInstance()->GetMeshOptimization());
+    memcpy(header.streamStrides, VERTEX_STREAM_STRIDES, sizeof(header.streamStrides));
+    header.meshCount = static_cast<uint32_t>(__meshes.size());
+    header.materialCount = static_cast<uint32_t>(__materials.size());
+    header.textureCount = static_cast<uint32_t>(__textures.size());
+    header.dependencyCount = static_cast<uint32_t>(__dependencies.size());
+
+    // Tables, then every stream of every mesh
+    std::vector<BakedMaterial> materials;
+    std::vector<BakedMaterialComponent> components;
+    for (const PendingMaterial & pending : __materials) {
+        BakedMaterial & material = materials.emplace_back(pending.material);
+        material.firstComponent = static_cast<uint32_t>(components.size());
+        material.componentCount = static_cast<uint32_t>(pending.components.size());
+        components.insert(components.end(), pending.components.begin(), pending.components.end());
+    }
+    header.componentCount = static_cast<uint32_t>(components.size());
+    uint64_t offset = AlignUp(sizeof(BakedModelHeader));
+    header.meshesOffset = offset;
+    offset = AlignUp(offset + __meshes.size() * sizeof(BakedMesh));
+    header.materialsOffset = offset;
+    offset = AlignUp(offset + materials.size() * sizeof(BakedMaterial));
+    header.componentsOffset = offset;
+    offset = AlignUp(offset + components.size() * sizeof(BakedMaterialComponent));
+    header.texturesOffset = offset;
+    offset = AlignUp(offset + __textures.size() * sizeof(BakedTexture));
+    header.dependenciesOffset = offset;
+    offset = AlignUp(offset + __dependencies.size() * sizeof(BakedDependency));
+    header.stringsOffset = offset;
+    header.stringsSize = __strings.size();
+    offset = AlignUp(offset + __strings.size());
+
+    std::vector<BakedMesh> meshes = __meshes;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        for (uint32_t stream = 0; stream < STREAM_COUNT; ++stream) {
+            if (!__meshStreams[i].streams[stream])
+                continue;
+            meshes[i].streamOffsets[stream] = offset;
+            offset = AlignUp(offset + static_cast<uint64_t>(meshes[i].vertexCount) * VERTEX_STREAM_STRIDES[stream]);
+        }
+        if (meshes[i].indexCount) {
+            meshes[i].indicesOffset = offset;
+            offset = AlignUp(offset + static_cast<uint64_t>(meshes[i].indexCount) * sizeof(uint32_t));
+        }
+        if (meshes[i].lodCount) {
+            meshes[i].lodsOffset = offset;
+            offset = AlignUp(offset + static_cast<uint64_t>(meshes[i].lodCount) * sizeof(MeshLod));
+        }
+    }
+
+    // Every chunk is padded to the next table or stream
+    static const uint8_t zeros[BAKED_MODEL_ALIGNMENT] = {};
+    std::vector<std::pair<const void *, size_t>> chunks;
+    const auto add = [&chunks](const void * data, const uint64_t size) {
+        chunks.emplace_back(data, size);
+        chunks.emplace_back(zeros, AlignUp(size) - size);
+    };
+    add(&header, sizeof(header));
+    add(meshes.data(), meshes.size() * sizeof(BakedMesh));
+    add(materials.data(), materials.size() * sizeof(BakedMaterial));
+    add(components.data(), components.size() * sizeof(BakedMaterialComponent));
+    add(__textures.data(), __textures.size() * sizeof(BakedTexture));
+    add(__dependencies.data(), __dependencies.size() * sizeof(BakedDependency));
+    add(__strings.data(), __strings.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        for (uint32_t stream = 0; stream < STREAM_COUNT; ++stream) {
+            if (__meshStreams[i].streams[stream])
+                add(__meshStreams[i].streams[stream], static_cast<uint64_t>(meshes[i].vertexCount) * VERTEX_STREAM_STRIDES[stream]);
+        }
+        if (meshes[i].indexCount)
+            add(__meshStreams[i].indices, static_cast<uint64_t>(meshes[i].indexCount) * sizeof(uint32_t));
+        if (meshes[i].lodCount)
+            add(__meshStreams[i].lods, static_cast<uint64_t>(meshes[i].lodCount) * sizeof(MeshLod));
+    }
+    if (BakedAsset::WriteFile(path, chunks) != Error::Success)
+        return Error::Failure;
+    Log::Print("Baked model: %s (%" PRIu64 " bytes)", path.c_str(), offset);
+    return Error::Success;
+}
+
+BakedModel::BakedModel()
+    : __header(nullptr)
+{
+}
+
+BakedModel::~BakedModel()
+{
+}
+
+bool BakedModel::__IsInFile(const uint64_t offset, const uint64_t size) const
+{
+    return offset <= __file.GetSize() && size <= __file.GetSize() - offset;
+}
+
+Error BakedModel::Open(const std::string& path, const std::string& sourcePath, const uint64_t sourceHash)
+{
+    VENOM_TRACE_FUNCTION();
+    __header = nullptr;
+    // Not baked yet
+    if (__file.Open(path) != Error::Success)
+        return Error::Failure;
+    const auto reject = [&](const char * reason) {
+        Log::Print("Ignoring baked model: %s (%s)", path.c_str(), reason);
+        __file.Close();
+        return Error::Failure;
+    };
+
+    if (__file.GetSize() < sizeof(BakedModelHeader))
+        return reject("truncated");
+    const BakedModelHeader * header = __At<BakedModelHeader>(0);
+    if (header->magic != BAKED_MODEL_MAGIC || header->version != BAKED_MODEL_VERSION
+        || memcmp(header->streamStrides, VERTEX_STREAM_STRIDES, sizeof(header->streamStrides)) != 0)
+        return reject("other version");
+    if (header->sourceHash != sourceHash)
+        return reject("source changed");
+    if (header->meshOptimization != static_cast<uint32_t>(Config::GetInstance()->GetMeshOptimization()))
+        return reject("other mesh optimization");
+    if (!__IsInFile(header->meshesOffset, static_cast<uint64_t>(header->meshCount) * sizeof(BakedMesh))
+        || !__IsInFile(header->materialsOffset, static_cast<uint64_t>(header->materialCount) * sizeof(BakedMaterial))
+        || !__IsInFile(header->componentsOffset, static_cast<uint64_t>(header->componentCount) * sizeof(BakedMaterialComponent))
+        || !__IsInFile(header->texturesOffset, static_cast<uint64_t>(header->textureCount) * sizeof(BakedTexture))
+        || !__IsInFile(header->dependenciesOffset, static_cast<uint64_t>(header->dependencyCount) * sizeof(BakedDependency))
+        || !__IsInFile(header->stringsOffset, header->stringsSize))
+        return reject("corrupted tables");
+
+    // Everything the accessors return must be in the file
+    const auto isString = [header](const uint32_t offset, const uint32_t size) {
+        return offset <= header->stringsSize && size <= header->stringsSize - offset;
+    };
+    for (uint32_t i = 0; i < header->meshCount; ++i) {
+        const BakedMesh & mesh = __At<BakedMesh>(header->meshesOffset)[i];
+        if (mesh.materialIndex >= header->materialCount)
+            return reject("corrupted mesh");
+        for (uint32_t stream = 0; stream < STREAM_COUNT; ++stream) {
+            if (mesh.streamOffsets[stream] && !__IsInFile(mesh.streamOffsets[stream], static_cast<uint64_t>(mesh.vertexCount) * VERTEX_STREAM_STRIDES[stream]))
+                return reject("corrupted mesh");
+        }
+        if (mesh.indexCount && !__IsInFile(mesh.indicesOffset, static_cast<uint64_t>(mesh.indexCount) * sizeof(uint32_t)))
+            return reject("corrupted mesh");
+        // Indices are handed to the GPU as is, one past the vertex buffer reads out of bounds
+        const uint32_t * indices = mesh.indexCount ? __At<uint32_t>(mesh.indicesOffset) : nullptr;
+        for (uint32_t index = 0; index < mesh.indexCount; ++index) {
+            if (indices[index] >= mesh.vertexCount)
+                return reject("corrupted mesh");
+        }
+        if (mesh.lodCount > MAX_MESH_LOD_COUNT || (mesh.lodCount && !__IsInFile(mesh.lodsOffset, static_cast<uint64_t>(mesh.lodCount) * sizeof(MeshLod))))
+            return reject("corrupted mesh");
+        for (uint32_t lod = 0; lod < mesh.lodCount; ++lod) {
+            const MeshLod & range = __At<MeshLod>(mesh.lodsOffset)[lod];
+            if (range.firstIndex > mesh.indexCount || range.indexCount > mesh.indexCount - range.firstIndex)
+                return reject("corrupted mesh");
+        }
+    }
+    for (uint32_t i = 0; i < header->materialCount; ++i) {
+        const BakedMaterial & material = __At<BakedMaterial>(header->materialsOffset)[i];
+        if (!isString(material.nameOffset, material.nameSize)
+            || material.firstComponent > header->componentCount || material.componentCount > header->componentCount - material.firstComponent)
+            return reject("corrupted material");
+    }
+    for (uint32_t i = 0; i < header->componentCount; ++i) {
+        const BakedMaterialComponent & component = __At<BakedMaterialComponent>(header->componentsOffset)[i];
+        if (component.type >= MaterialComponentType::MAX_COMPONENT
+            || (component.valueType == MaterialComponentValueType::TEXTURE && component.textureIndex >= header->textureCount))
+            return reject("corrupted material");
+    }
+    for (uint32_t i = 0; i < header->textureCount; ++i) {
+        const BakedTexture & texture = __At<BakedTexture>(header->texturesOffset)[i];
+        if (!isString(texture.pathOffset, texture.pathSize))
+            return reject("corrupted texture");
+    }
+    // Last, hashing reads every dependency in full
+    const std::filesystem::path sourceFolder = std::filesystem::path(sourcePath).parent_path();
+    uint64_t dependencyHash = 0;
+    for (uint32_t i = 0; i < header->dependencyCount; ++i) {
+        const BakedDependency & dependency = __At<BakedDependency>(header->dependenciesOffset)[i];
+        if (!isString(dependency.pathOffset, dependency.pathSize))
+            return reject("corrupted dependency");
+        const std::string dependencyPath(__At<char>(header->stringsOffset + dependency.pathOffset), dependency.pathSize);
+        uint64_t hash;
+        if (BakedAsset::HashFile((sourceFolder / dependencyPath).string(), hash) != Error::Success)
+            return reject("dependency missing");
+        dependencyHash = BakedAsset::HashCombine(dependencyHash, hash);
+    }
+    if (dependencyHash != header->dependencyHash)
+        return reject("dependency changed");
+    __header = header;
+    return Error::Success;
+}
+
+uint32_t BakedModel::GetMeshCount() const
+{
+    return __header ? __header->meshCount : 0;
+}
+
+const BakedMesh& BakedModel::GetMesh(const uint32_t index) const
+{
+    venom_assert(index < GetMeshCount(), "Mesh out of range");
+    return __At<BakedMesh>(__header->meshesOffset)[index];
+}
+
+MeshStreams BakedModel::GetMeshStreams(const uint32_t index) const
+{
+    const BakedMesh & mesh = GetMesh(index);
+    MeshStreams streams;
+    streams.vertexCount = mesh.vertexCount;
+    for (uint32_t stream = 0; stream < STREAM_COUNT; ++stream)
+        streams.streams[stream] = mesh.streamOffsets[stream] ? __At<uint8_t>(mesh.streamOffsets[stream]) : nullptr;
+    streams.indices = mesh.indexCount ? __At<uint32_t>(mesh.indicesOffset) : nullptr;
+    streams.indexCount = mesh.indexCount;
+    streams.lods = mesh.lodCount ? __At<MeshLod>(mesh.lodsOffset) : nullptr;
+    streams.lodCount = mesh.lodCount;
+    return streams;
+}
+
+uint32_t BakedModel::GetMaterialCount() const
+{
+    return __header ? __header->materialCount : 0;
+}
+
+std::string_view BakedModel::GetMaterialName(const uint32_t index) const
+{
+    venom_assert(index < GetMaterialCount(), "Material out of range");
+    const BakedMaterial & material = __At<BakedMaterial>(__header->materialsOffset)[index];
+    return {__At<char>(__header->stringsOffset + material.nameOffset), material.nameSize};
+}
+
+const BakedMaterialComponent* BakedModel::GetMaterialComponents(const uint32_t index, uint32_t& count) const
+{
+    venom_assert(index < GetMaterialCount(), "Material out of range");
+    const BakedMaterial & material = __At<BakedMaterial>(__header->materialsOffset)[index];
+    count = material.componentCount;
+    return __At<BakedMaterialComponent>(__header->componentsOffset) + material.firstComponent;
+}
+
+uint32_t BakedModel::GetTextureCount() const
+{
+    return __header ? __header->textureCount : 0;
+}
+
+std::string_view BakedModel::GetTexturePath(const uint32_t index) const
+{
+    venom_assert(index < GetTextureCount(), "Texture out of range");
+    const BakedTexture & texture = __At<BakedTexture>(__header->texturesOffset)[index];
+    return {__At<char>(__header->stringsOffset + texture.pathOffset), texture.pathSize};
+}
+}
+}
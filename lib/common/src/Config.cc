@@ -12,6 +12,20 @@ namespace venom
 namespace common
 {
 Config::Config()
+    : __stagingBufferSize(64 * 1024 * 1024)
+    , __headless(false)
+    , __headlessWidth(1280)
+    , __headlessHeight(720)
+    , __maxFrameCount(0)
+    , __readbackFormat(ReadbackFormat::None)
+    , __readbackOutputPath(".")
+    , __sceneModelPath("eye/eye.obj")
+    , __pipelineCacheDirectory(".")
+    , __bakedAssetDirectory("baked")
+    , __meshOptimization(MeshOptimization::VertexCache)
+    , __lodScreenSizes({0.5f, 0.25f, 0.1f})
+    , __lodHysteresis(0.1f)
+    , __bindlessTextures(true)
 {
 }
 
@@ -29,5 +43,151 @@ GraphicsPlugin::GraphicsPluginType Config::GetGraphicsPluginType() const
 {
     return GraphicsPlugin::GraphicsPluginType::Vulkan;
 }
+
+size_t Config::GetStagingBufferSize() const
+{
+    return __stagingBufferSize;
+}
+
+void Config::SetStagingBufferSize(const size_t size)
+{
+    __stagingBufferSize = size;
+}
+
+bool Config::IsHeadless() const
+{
+    return __headless;
+}
+
+void Config::SetHeadless(const bool headless)
+{
+    __headless = headless;
+}
+
+uint32_t Config::GetHeadlessWidth() const
+{
+    return __headlessWidth;
+}
+
+uint32_t Config::GetHeadlessHeight() const
+{
+    return __headlessHeight;
+}
+
+void Config::SetHeadlessResolution(const uint32_t width, const uint32_t height)
+{
+    __headlessWidth = width;
+    __headlessHeight = height;
+}
+
+uint64_t Config::GetMaxFrameCount() const
+{
+    return __maxFrameCount;
+}
+
+void Config::SetMaxFrameCount(const uint64_t frameCount)
+{
+    __maxFrameCount = frameCount;
+}
+
+Config::ReadbackFormat Config::GetReadbackFormat() const
+{
+    return __readbackFormat;
+}
+
+void Config::SetReadbackFormat(const ReadbackFormat format)
+{
+    __readbackFormat = format;
+}
+
+const std::string& Config::GetReadbackOutputPath() const
+{
+    return __readbackOutputPath;
+}
+
+void Config::SetReadbackOutputPath(const std::string& path)
+{
+    __readbackOutputPath = path;
+}
+
+const std::string& Config::GetSceneModelPath() const
+{
+    return __sceneModelPath;
+}
+
+void Config::SetSceneModelPath(const std::string& path)
+{
+    __sceneModelPath = path;
+}
+
+const std::string& Config::GetTraceOutputPath() const
+{
+    return __traceOutputPath;
+}
+
+void Config::SetTraceOutputPath(const std::string& path)
+{
+    __traceOutputPath = path;
+}
+
+const std::string& Config::GetPipelineCacheDirectory() const
+{
+    return __pipelineCacheDirectory;
+}
+
+void Config::SetPipelineCacheDirectory(const std::string& path)
+{
+    __pipelineCacheDirectory = path;
+}
+
+const std::string& Config::GetBakedAssetDirectory() const
+{
+    return __bakedAssetDirectory;
+}
+
+void Config::SetBakedAssetDirectory(const std::string& path)
+{
+    __bakedAssetDirectory = path;
+}
+
+Config::MeshOptimization Config::GetMeshOptimization() const
+{
+    return __meshOptimization;
+}
+
+void Config::SetMeshOptimization(const MeshOptimization optimization)
+{
+    __meshOptimization = optimization;
+}
+
+const std::vector<float>& Config::GetLodScreenSizes() const
+{
+    return __lodScreenSizes;
+}
+
+void Config::SetLodScreenSizes(const std::vector<float>& screenSizes)
+{
+    __lodScreenSizes = screenSizes;
+}
+
+float Config::GetLodHysteresis() const
+{
+    return __lodHysteresis;
+}
+
+void Config::SetLodHysteresis(const float hysteresis)
+{
+    __lodHysteresis = hysteresis;
+}
+
+bool Config::IsBindlessTexturesEnabled() const
+{
+    return __bindlessTextures;
+}
+
+void Config::SetBindlessTexturesEnabled(const bool enabled)
+{
+    __bindlessTextures = enabled;
+}
 }
 }
\ No newline at end of file
@@ -7,12 +7,14 @@
 ///
 #include <venom/common/Context.h>
 #include <venom/common/Log.h>
+#include <venom/common/Config.h>
 
 namespace venom::common
 {
 
 Context::Context()
     : __window(nullptr)
+    , __glfwInitialized(false)
 {
 }
 
@@ -21,12 +23,21 @@ Context::~Context()
     if (__window) {
         glfwDestroyWindow(__window);
     }
-    glfwTerminate();
+    if (__glfwInitialized)
+        glfwTerminate();
 }
 
 Error Context::InitContext()
 {
-    glfwInit();
+    // No display needed (CI, render farms)
+    if (Config::GetInstance()->IsHeadless())
+        return Error::Success;
+
+    if (glfwInit() != GLFW_TRUE) {
+        Log::Error("Failed to initialize GLFW");
+        return Error::InitializationFailed;
+    }
+    __glfwInitialized = true;
     glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
@@ -59,14 +70,22 @@ Error Context::InitContext()
     return Error::Success;
 }
 
+bool Context::IsHeadless() const
+{
+    return __window == nullptr;
+}
+
 bool Context::ShouldClose()
 {
+    if (!__window)
+        return false;
     return glfwWindowShouldClose(__window);
 }
 
 void Context::PollEvents()
 {
-    glfwPollEvents();
+    if (__glfwInitialized)
+        glfwPollEvents();
 }
 
 GLFWwindow* Context::GetWindow()
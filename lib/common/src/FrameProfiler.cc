@@ -0,0 +1,144 @@
+///
+/// Project: VenomEngine
+/// @file FrameProfiler.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/FrameProfiler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace venom
+{
+namespace common
+{
+FrameProfiler::FrameProfiler()
+    : __currentSample{}
+    , __warmupFrameCount(0)
+    , __frameCount(0)
+    , __enabled(false)
+{
+}
+
+FrameProfiler::~FrameProfiler()
+{
+}
+
+FrameProfiler* FrameProfiler::GetInstance()
+{
+    static FrameProfiler instance;
+    return &instance;
+}
+
+void FrameProfiler::Enable(const size_t expectedFrameCount, const size_t warmupFrameCount)
+{
+    __samples.clear();
+    // No allocation while measuring
+    __samples.reserve(expectedFrameCount);
+    __warmupFrameCount = warmupFrameCount;
+    __frameCount = 0;
+    __enabled = true;
+}
+
+void FrameProfiler::Disable()
+{
+    __enabled = false;
+}
+
+bool FrameProfiler::IsEnabled() const
+{
+    return __enabled;
+}
+
+void FrameProfiler::BeginFrame()
+{
+    if (!__enabled)
+        return;
+    __currentSample = {};
+    __frameTimer.Reset();
+}
+
+void FrameProfiler::AddPhaseTime(const FramePhase phase, const uint64_t nanoseconds)
+{
+    if (!__enabled)
+        return;
+    __currentSample.phases[static_cast<size_t>(phase)] += nanoseconds;
+}
+
+void FrameProfiler::EndFrame()
+{
+    if (!__enabled)
+        return;
+    __currentSample.total = __frameTimer.GetNanoSeconds();
+    if (__frameCount++ >= __warmupFrameCount)
+        __samples.emplace_back(__currentSample);
+}
+
+const std::vector<FrameSample>& FrameProfiler::GetSamples() const
+{
+    return __samples;
+}
+
+FrameTimeStats FrameProfiler::ComputePhaseStats(const FramePhase phase) const
+{
+    std::vector<uint64_t> values(__samples.size());
+    std::transform(__samples.begin(), __samples.end(), values.begin(), [phase](const FrameSample & sample) {
+        return sample.phases[static_cast<size_t>(phase)];
+    });
+    return __ComputeStats(values);
+}
+
+FrameTimeStats FrameProfiler::ComputeFrameStats() const
+{
+    std::vector<uint64_t> values(__samples.size());
+    std::transform(__samples.begin(), __samples.end(), values.begin(), [](const FrameSample & sample) {
+        return sample.total;
+    });
+    return __ComputeStats(values);
+}
+
+const char* FrameProfiler::GetPhaseName(const FramePhase phase)
+{
+    switch (phase)
+    {
+    case FramePhase::Poll: return "poll";
+    case FramePhase::Record: return "record";
+    case FramePhase::Submit: return "submit";
+    case FramePhase::Present: return "present";
+    default: return "unknown";
+    }
+}
+
+FrameTimeStats FrameProfiler::__ComputeStats(std::vector<uint64_t>& values) const
+{
+    FrameTimeStats stats{};
+    if (values.empty())
+        return stats;
+    std::sort(values.begin(), values.end());
+    // Nearest rank
+    const auto percentile = [&values](const double p) {
+        const size_t rank = static_cast<size_t>(std::ceil(p * values.size()));
+        return values[std::clamp<size_t>(rank, 1, values.size()) - 1] / 1000.0;
+    };
+    stats.p50 = percentile(0.50);
+    stats.p95 = percentile(0.95);
+    stats.p99 = percentile(0.99);
+    stats.mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size() / 1000.0;
+    stats.max = values.back() / 1000.0;
+    return stats;
+}
+
+FramePhaseScope::FramePhaseScope(const FramePhase phase)
+    : __phase(phase)
+{
+}
+
+FramePhaseScope::~FramePhaseScope()
+{
+    FrameProfiler::GetInstance()->AddPhaseTime(__phase, __timer.GetNanoSeconds());
+}
+}
+}
@@ -0,0 +1,49 @@
+///
+/// Project: VenomEngine
+/// @file ImageWriter.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/ImageWriter.h>
+#include <venom/common/Log.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <fstream>
+
+namespace venom
+{
+namespace common
+{
+Error ImageWriter::WritePNG(const char* path, const uint32_t width, const uint32_t height, const uint32_t channels,
+    const void* data, const size_t rowPitch)
+{
+    if (stbi_write_png(path, static_cast<int>(width), static_cast<int>(height), static_cast<int>(channels), data, static_cast<int>(rowPitch)) == 0) {
+        Log::Error("Failed to write PNG: %s", path);
+        return Error::Failure;
+    }
+    return Error::Success;
+}
+
+Error ImageWriter::WriteRaw(const char* path, const uint32_t width, const uint32_t height, const uint32_t channels,
+    const void* data, const size_t rowPitch)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        Log::Error("Failed to open file: %s", path);
+        return Error::Failure;
+    }
+    const size_t rowSize = static_cast<size_t>(width) * channels;
+    const char * row = static_cast<const char *>(data);
+    for (uint32_t y = 0; y < height; ++y, row += rowPitch)
+        file.write(row, static_cast<std::streamsize>(rowSize));
+    if (!file) {
+        Log::Error("Failed to write raw image: %s", path);
+        return Error::Failure;
+    }
+    return Error::Success;
+}
+}
+}
@@ -0,0 +1,141 @@
+///
+/// Project: VenomEngine
+/// @file MappedFile.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/MappedFile.h>
+#include <venom/common/Log.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else // Linux & Apple
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+namespace venom
+{
+namespace common
+{
+MappedFile::MappedFile()
+    : __data(nullptr)
+    , __size(0)
+#ifdef _WIN32
+    , __mapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : __data(std::exchange(other.__data, nullptr))
+    , __size(std::exchange(other.__size, 0))
+#ifdef _WIN32
+    , __mapping(std::exchange(other.__mapping, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        Close();
+        __data = std::exchange(other.__data, nullptr);
+        __size = std::exchange(other.__size, 0);
+#ifdef _WIN32
+        __mapping = std::exchange(other.__mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+Error MappedFile::Open(const std::string& path)
+{
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return Error::Failure;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return Error::Failure;
+    }
+    // The mapping keeps the file open
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        Log::Error("Failed to map file: %s", path.c_str());
+        return Error::Failure;
+    }
+    void * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        Log::Error("Failed to map file: %s", path.c_str());
+        CloseHandle(mapping);
+        return Error::Failure;
+    }
+    __mapping = mapping;
+    __size = static_cast<size_t>(size.QuadPart);
+#else // Linux & Apple
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return Error::Failure;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return Error::Failure;
+    }
+    // The mapping keeps the file open
+    void * data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        Log::Error("Failed to map file: %s", path.c_str());
+        return Error::Failure;
+    }
+    __size = static_cast<size_t>(st.st_size);
+#endif
+    __data = static_cast<const uint8_t *>(data);
+    return Error::Success;
+}
+
+void MappedFile::Close()
+{
+    if (__data == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(__data);
+    CloseHandle(__mapping);
+    __mapping = nullptr;
+#else // Linux & Apple
+    munmap(const_cast<uint8_t *>(__data), __size);
+#endif
+    __data = nullptr;
+    __size = 0;
+}
+
+bool MappedFile::IsOpen() const
+{
+    return __data != nullptr;
+}
+
+const uint8_t* MappedFile::GetData() const
+{
+    return __data;
+}
+
+size_t MappedFile::GetSize() const
+{
+    return __size;
+}
+}
+}
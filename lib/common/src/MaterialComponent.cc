@@ -43,7 +43,13 @@ void MaterialComponent::SetValue(const Texture* texture)
 
 const Texture* MaterialComponent::GetTexture() const
 {
-    return __texture;
+    // The union may hold a color
+    return __valueType == MaterialComponentValueType::TEXTURE ? __texture : nullptr;
+}
+
+MaterialComponentValueType MaterialComponent::GetValueType() const
+{
+    return __valueType;
 }
 }
 }
\ No newline at end of file
@@ -32,6 +32,27 @@ void RotateMatrix(Mat4& matrix, const Vec3& axis, const float angle)
 #endif
 }
 
+Vec3 TransformPoint(const Mat4& matrix, const Vec3& point)
+{
+#if defined(VENOM_MATH_DXMATH)
+    Vec3 result;
+    DirectX::XMStoreFloat3(&result, DirectX::XMVector3TransformCoord(DirectX::XMLoadFloat3(&point), matrix));
+    return result;
+#elif defined(VENOM_MATH_GLM)
+    return Vec3(matrix * glm::vec4(point, 1.0f));
+#endif
+}
+
+float GetMaxScale(const Mat4& matrix)
+{
+#if defined(VENOM_MATH_DXMATH)
+    return DirectX::XMVectorGetX(DirectX::XMVectorMax(DirectX::XMVector3Length(matrix.r[0]),
+        DirectX::XMVectorMax(DirectX::XMVector3Length(matrix.r[1]), DirectX::XMVector3Length(matrix.r[2]))));
+#elif defined(VENOM_MATH_GLM)
+    return glm::max(glm::length(Vec3(matrix[0])), glm::max(glm::length(Vec3(matrix[1])), glm::length(Vec3(matrix[2]))));
+#endif
+}
+
 Mat4 LookAtLH(const Vec3& eye, const Vec3& center, const Vec3& up)
 {
 #if defined(VENOM_MATH_DXMATH)
@@ -6,6 +6,12 @@
 /// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
 ///
 #include <venom/common/plugin/graphics/Mesh.h>
+#include <venom/common/Config.h>
+#include <venom/common/Log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace venom
 {
@@ -14,6 +20,9 @@ namespace common
 Mesh::Mesh()
     : GraphicsPluginObject()
     , __material(nullptr)
+    , __boundingSphereCenter(0.0f, 0.0f, 0.0f)
+    , __boundingSphereRadius(0.0f)
+    , __selectedLod(0)
 {
 }
 
@@ -35,5 +44,121 @@ const Material* Mesh::GetMaterial() const
 {
     return __material;
 }
+
+uint32_t Mesh::GetLodCount() const
+{
+    return static_cast<uint32_t>(__lods.size());
+}
+
+const MeshLod& Mesh::GetLod(const uint32_t lod) const
+{
+    venom_assert(lod < __lods.size(), "LOD out of range");
+    return __lods[lod];
+}
+
+const vcm::Vec3& Mesh::GetBoundingSphereCenter() const
+{
+    return __boundingSphereCenter;
+}
+
+float Mesh::GetBoundingSphereRadius() const
+{
+    return __boundingSphereRadius;
+}
+
+float Mesh::GetScreenSize(const vcm::Mat4& transform, const LodView& view) const
+{
+    const vcm::Vec3 center = vcm::TransformPoint(transform, __boundingSphereCenter);
+    const float radius = __boundingSphereRadius * vcm::GetMaxScale(transform);
+    const float dx = center.x - view.cameraPosition.x;
+    const float dy = center.y - view.cameraPosition.y;
+    const float dz = center.z - view.cameraPosition.z;
+    const float distance = sqrtf(dx * dx + dy * dy + dz * dz);
+    // Camera inside the sphere
+    if (distance <= radius)
+        return std::numeric_limits<float>::max();
+    return radius * view.projectionScale / distance;
+}
+
+uint32_t Mesh::SelectLod(const float screenSize)
+{
+    if (__lods.empty())
+        return 0;
+    const Config * config = Config::GetInstance();
+    // LOD i + 1 is drawn under thresholds[i]
+    const std::vector<float> & thresholds = config->GetLodScreenSizes();
+    const float hysteresis = config->GetLodHysteresis();
+    const uint32_t maxLod = std::min(GetLodCount() - 1, static_cast<uint32_t>(thresholds.size()));
+    uint32_t lod = std::min(__selectedLod, maxLod);
+    while (lod > 0 && screenSize > thresholds[lod - 1] * (1.0f + hysteresis))
+        --lod;
+    while (lod < maxLod && screenSize < thresholds[lod] * (1.0f - hysteresis))
+        ++lod;
+    __selectedLod = lod;
+    return lod;
+}
+
+uint32_t Mesh::GetSelectedLod() const
+{
+    return __selectedLod;
+}
+
+vc::Error Mesh::__LoadMeshFromCurrentData()
+{
+    return __LoadMesh(__data.GetStreams());
+}
+
+vc::Error Mesh::__LoadMesh(const MeshStreams& streams)
+{
+    if (streams.lodCount > 0)
+        __lods.assign(streams.lods, streams.lods + streams.lodCount);
+    else if (streams.indices)
+        __lods.assign(1, MeshLod{0, streams.indexCount, 0.0f});
+    else
+        __lods.clear();
+    __selectedLod = 0;
+
+    // Center of the bounding box, good enough for LOD selection
+    const vcm::VertexPos * positions = static_cast<const vcm::VertexPos *>(streams.streams[static_cast<uint32_t>(VertexStream::Position)]);
+    if (positions && streams.vertexCount > 0) {
+        vcm::Vec3 min = positions[0];
+        vcm::Vec3 max = positions[0];
+        for (uint32_t i = 1; i < streams.vertexCount; ++i) {
+            min.x = std::min(min.x, positions[i].x);
+            min.y = std::min(min.y, positions[i].y);
+            min.z = std::min(min.z, positions[i].z);
+            max.x = std::max(max.x, positions[i].x);
+            max.y = std::max(max.y, positions[i].y);
+            max.z = std::max(max.z, positions[i].z);
+        }
+        __boundingSphereCenter = vcm::Vec3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+        float radiusSquared = 0.0f;
+        for (uint32_t i = 0; i < streams.vertexCount; ++i) {
+            const float dx = positions[i].x - __boundingSphereCenter.x;
+            const float dy = positions[i].y - __boundingSphereCenter.y;
+            const float dz = positions[i].z - __boundingSphereCenter.z;
+            radiusSquared = std::max(radiusSquared, dx * dx + dy * dy + dz * dz);
+        }
+        __boundingSphereRadius = sqrtf(radiusSquared);
+    }
+    return __LoadMeshFromStreams(streams);
+}
+
+MeshStreams MeshData::GetStreams() const
+{
+    MeshStreams streams;
+    streams.vertexCount = static_cast<uint32_t>(positions.size());
+    streams.streams[static_cast<uint32_t>(VertexStream::Position)] = positions.empty() ? nullptr : positions.data();
+    streams.streams[static_cast<uint32_t>(VertexStream::Normal)] = normals.empty() ? nullptr : normals.data();
+    streams.streams[static_cast<uint32_t>(VertexStream::Color)] = colors[0].empty() ? nullptr : colors[0].data();
+    streams.streams[static_cast<uint32_t>(VertexStream::UV)] = uvs[0].empty() ? nullptr : uvs[0].data();
+    streams.streams[static_cast<uint32_t>(VertexStream::Tangent)] = tangents.empty() ? nullptr : tangents.data();
+    streams.streams[static_cast<uint32_t>(VertexStream::Bitangent)] = bitangents.empty() ? nullptr : bitangents.data();
+    streams.indices = indices.empty() ? nullptr : indices.data();
+    streams.indexCount = static_cast<uint32_t>(indices.size());
+    streams.lods = lods.empty() ? nullptr : lods.data();
+    streams.lodCount = static_cast<uint32_t>(lods.size());
+    return streams;
+}
+}
 }
-}
\ No newline at end of file
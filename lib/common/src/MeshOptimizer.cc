@@ -0,0 +1,475 @@
+///
+/// Project: VenomEngine
+/// @file MeshOptimizer.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/plugin/graphics/MeshOptimizer.h>
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace venom
+{
+namespace common
+{
+// Forsyth's scoring, tuned for a cache of SCORING_CACHE_SIZE
+static constexpr uint32_t SCORING_CACHE_SIZE = 32;
+static constexpr float CACHE_DECAY_POWER = 1.5f;
+static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+static float GetVertexScore(const int32_t cachePosition, const uint32_t liveTriangleCount)
+{
+    // Nothing left to draw with it
+    if (liveTriangleCount == 0)
+        return -1.0f;
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        // Vertices of the last triangle score the same whatever their order, so the next one isn't biased
+        if (cachePosition < 3) {
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            const float scaler = 1.0f / static_cast<float>(SCORING_CACHE_SIZE - 3);
+            score = powf(1.0f - static_cast<float>(cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+        }
+    }
+    // Vertices with few triangles left are finished off first, instead of leaving lone triangles for later
+    score += VALENCE_BOOST_SCALE * powf(static_cast<float>(liveTriangleCount), -VALENCE_BOOST_POWER);
+    return score;
+}
+
+VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const uint32_t * indices, const size_t indexCount, const uint32_t vertexCount,
+    const uint32_t cacheSize)
+{
+    VertexCacheStatistics statistics{0, 0.0f, 0.0f};
+    if (indexCount < 3)
+        return statistics;
+    // A vertex is in the FIFO while less than cacheSize vertices were transformed after it, hits don't refresh it
+    std::vector<uint32_t> transformTimes(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    uint32_t referencedVertexCount = 0;
+    std::vector<bool> referenced(vertexCount, false);
+    for (size_t i = 0; i < indexCount; ++i) {
+        const uint32_t vertex = indices[i];
+        if (!referenced[vertex]) {
+            referenced[vertex] = true;
+            ++referencedVertexCount;
+        }
+        if (time - transformTimes[vertex] > cacheSize) {
+            transformTimes[vertex] = time++;
+            ++statistics.transformedVertexCount;
+        }
+    }
+    statistics.acmr = static_cast<float>(statistics.transformedVertexCount) / static_cast<float>(indexCount / 3);
+    statistics.atvr = static_cast<float>(statistics.transformedVertexCount) / static_cast<float>(referencedVertexCount);
+    return statistics;
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t * indices, const size_t indexCount, const uint32_t vertexCount)
+{
+    VENOM_TRACE_FUNCTION();
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2)
+        return;
+
+    // Triangles not emitted yet of every vertex, packed one vertex after the other
+    std::vector<uint32_t> liveTriangleCounts(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        ++liveTriangleCounts[indices[i]];
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangleCounts[v];
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t)
+            for (size_t k = 0; k < 3; ++k)
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+    }
+
+    std::vector<float> vertexScores(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        vertexScores[v] = GetVertexScore(-1, liveTriangleCounts[v]);
+    std::vector<float> triangleScores(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t)
+        triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    // Vertices past SCORING_CACHE_SIZE are the ones evicted by the last triangle
+    uint32_t cache[SCORING_CACHE_SIZE + 3];
+    uint32_t newCache[SCORING_CACHE_SIZE + 3];
+    uint32_t cacheCount = 0;
+    size_t nextTriangle = 0;
+    int64_t bestTriangle = -1;
+    while (result.size() < triangleCount * 3) {
+        // Dead end, none of the cached vertices has triangles left: restart from the first triangle not emitted yet
+        if (bestTriangle < 0) {
+            while (emitted[nextTriangle])
+                ++nextTriangle;
+            bestTriangle = static_cast<int64_t>(nextTriangle);
+        }
+        const uint32_t * triangle = indices + bestTriangle * 3;
+        result.insert(result.end(), triangle, triangle + 3);
+        emitted[bestTriangle] = true;
+
+        // The triangle's vertices move to the front of the cache, pushing back the others
+        uint32_t newCacheCount = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            const uint32_t vertex = triangle[k];
+            uint32_t * live = adjacency.data() + adjacencyOffsets[vertex];
+            uint32_t * liveEnd = live + liveTriangleCounts[vertex];
+            // Degenerate triangles are listed once per reference, so removed once per reference too
+            *std::find(live, liveEnd, static_cast<uint32_t>(bestTriangle)) = *(liveEnd - 1);
+            --liveTriangleCounts[vertex];
+            if (std::find(newCache, newCache + newCacheCount, vertex) == newCache + newCacheCount)
+                newCache[newCacheCount++] = vertex;
+        }
+        for (uint32_t i = 0; i < cacheCount; ++i) {
+            const uint32_t vertex = cache[i];
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+                newCache[newCacheCount++] = vertex;
+        }
+
+        // Rescores the cached & evicted vertices, then picks the best triangle among the cached vertices' ones
+        for (uint32_t i = 0; i < newCacheCount; ++i) {
+            const uint32_t vertex = newCache[i];
+            const int32_t position = i < SCORING_CACHE_SIZE ? static_cast<int32_t>(i) : -1;
+            const float score = GetVertexScore(position, liveTriangleCounts[vertex]);
+            const float delta = score - vertexScores[vertex];
+            vertexScores[vertex] = score;
+            const uint32_t * live = adjacency.data() + adjacencyOffsets[vertex];
+            for (uint32_t j = 0; j < liveTriangleCounts[vertex]; ++j)
+                triangleScores[live[j]] += delta;
+        }
+        cacheCount = std::min(newCacheCount, SCORING_CACHE_SIZE);
+        std::copy(newCache, newCache + cacheCount, cache);
+
+        bestTriangle = -1;
+        float bestScore = std::numeric_limits<float>::lowest();
+        for (uint32_t i = 0; i < cacheCount; ++i) {
+            const uint32_t vertex = cache[i];
+            const uint32_t * live = adjacency.data() + adjacencyOffsets[vertex];
+            for (uint32_t j = 0; j < liveTriangleCounts[vertex]; ++j) {
+                if (triangleScores[live[j]] > bestScore) {
+                    bestScore = triangleScores[live[j]];
+                    bestTriangle = live[j];
+                }
+            }
+        }
+    }
+    std::copy(result.begin(), result.end(), indices);
+}
+
+void MeshOptimizer::OptimizeOverdraw(uint32_t * indices, const size_t indexCount, const vcm::VertexPos * positions, const uint32_t vertexCount,
+    const float threshold)
+{
+    VENOM_TRACE_FUNCTION();
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount < 2)
+        return;
+
+    // Cache misses of every triangle, in the current order
+    std::vector<uint8_t> triangleMisses(triangleCount);
+    {
+        std::vector<uint32_t> transformTimes(vertexCount, 0);
+        uint32_t time = DEFAULT_CACHE_SIZE + 1;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            uint8_t misses = 0;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[t * 3 + k];
+                if (time - transformTimes[vertex] > DEFAULT_CACHE_SIZE) {
+                    transformTimes[vertex] = time++;
+                    ++misses;
+                }
+            }
+            triangleMisses[t] = misses;
+        }
+    }
+    uint32_t totalMisses = 0;
+    for (const uint8_t misses : triangleMisses)
+        totalMisses += misses;
+    const float maxAcmr = static_cast<float>(totalMisses) / static_cast<float>(triangleCount) * threshold;
+
+    // Clusters start where the cache fully restarts anyway, or where cutting keeps the cluster within maxAcmr
+    std::vector<uint32_t> clusterStarts;
+    uint32_t clusterMisses = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        if (t == 0 || triangleMisses[t] == 3) {
+            clusterStarts.push_back(static_cast<uint32_t>(t));
+            clusterMisses = 0;
+        }
+        clusterMisses += triangleMisses[t];
+        const size_t clusterSize = t + 1 - clusterStarts.back();
+        if (t + 1 < triangleCount && triangleMisses[t + 1] != 3 && clusterSize > 1
+            && static_cast<float>(clusterMisses) <= maxAcmr * static_cast<float>(clusterSize)) {
+            clusterStarts.push_back(static_cast<uint32_t>(t + 1));
+            clusterMisses = 0;
+        }
+    }
+    const size_t clusterCount = clusterStarts.size();
+    clusterStarts.push_back(static_cast<uint32_t>(triangleCount));
+    if (clusterCount < 2)
+        return;
+
+    // Area weighted centroid & summed normal of every cluster
+    struct Cluster
+    {
+        float centroid[3];
+        float normal[3];
+        float area;
+    };
+    std::vector<Cluster> clusters(clusterCount, Cluster{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, 0.0f});
+    float meshCentroid[3] = {0.0f, 0.0f, 0.0f};
+    float meshArea = 0.0f;
+    for (size_t c = 0; c < clusterCount; ++c) {
+        Cluster & cluster = clusters[c];
+        for (uint32_t t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t) {
+            const vcm::VertexPos & a = positions[indices[t * 3]];
+            const vcm::VertexPos & b = positions[indices[t * 3 + 1]];
+            const vcm::VertexPos & c0 = positions[indices[t * 3 + 2]];
+            const float ab[3] = {b.x - a.x, b.y - a.y, b.z - a.z};
+            const float ac[3] = {c0.x - a.x, c0.y - a.y, c0.z - a.z};
+            const float normal[3] = {ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0]};
+            const float area = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            const float center[3] = {(a.x + b.x + c0.x) / 3.0f, (a.y + b.y + c0.y) / 3.0f, (a.z + b.z + c0.z) / 3.0f};
+            for (int k = 0; k < 3; ++k) {
+                cluster.centroid[k] += center[k] * area;
+                cluster.normal[k] += normal[k];
+            }
+            cluster.area += area;
+        }
+        for (int k = 0; k < 3; ++k)
+            meshCentroid[k] += cluster.centroid[k];
+        meshArea += cluster.area;
+        if (cluster.area > 0.0f) {
+            for (int k = 0; k < 3; ++k)
+                cluster.centroid[k] /= cluster.area;
+        }
+    }
+    if (meshArea > 0.0f) {
+        for (int k = 0; k < 3; ++k)
+            meshCentroid[k] /= meshArea;
+    }
+
+    // The further a cluster faces away from the mesh's center, the more likely it occludes the others
+    std::vector<float> sortKeys(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        const Cluster & cluster = clusters[c];
+        const float length = sqrtf(cluster.normal[0] * cluster.normal[0] + cluster.normal[1] * cluster.normal[1] + cluster.normal[2] * cluster.normal[2]);
+        float key = 0.0f;
+        if (length > 0.0f) {
+            for (int k = 0; k < 3; ++k)
+                key += (cluster.centroid[k] - meshCentroid[k]) * cluster.normal[k];
+            key /= length;
+        }
+        sortKeys[c] = key;
+    }
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c)
+        order[c] = static_cast<uint32_t>(c);
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](const uint32_t a, const uint32_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    for (const uint32_t c : order)
+        result.insert(result.end(), indices + clusterStarts[c] * 3, indices + clusterStarts[c + 1] * 3);
+    std::copy(result.begin(), result.end(), indices);
+}
+
+template<typename T>
+static void RemapStream(std::vector<T> & stream, const std::vector<uint32_t> & remap, const uint32_t newVertexCount)
+{
+    if (stream.empty())
+        return;
+    std::vector<T> remapped(newVertexCount);
+    for (size_t v = 0; v < stream.size(); ++v) {
+        if (remap[v] != UINT32_MAX)
+            remapped[remap[v]] = stream[v];
+    }
+    stream = std::move(remapped);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(MeshData & data)
+{
+    VENOM_TRACE_FUNCTION();
+    const uint32_t vertexCount = static_cast<uint32_t>(data.positions.size());
+    std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+    uint32_t newVertexCount = 0;
+    for (uint32_t & index : data.indices) {
+        if (remap[index] == UINT32_MAX)
+            remap[index] = newVertexCount++;
+        index = remap[index];
+    }
+
+    RemapStream(data.positions, remap, newVertexCount);
+    RemapStream(data.normals, remap, newVertexCount);
+    for (auto & colors : data.colors)
+        RemapStream(colors, remap, newVertexCount);
+    for (auto & uvs : data.uvs)
+        RemapStream(uvs, remap, newVertexCount);
+    RemapStream(data.tangents, remap, newVertexCount);
+    RemapStream(data.bitangents, remap, newVertexCount);
+}
+
+void MeshOptimizer::Optimize(MeshData & data, const bool overdraw)
+{
+    // Only triangle lists
+    if (data.indices.empty() || data.indices.size() % 3 != 0)
+        return;
+    const uint32_t vertexCount = static_cast<uint32_t>(data.positions.size());
+    OptimizeVertexCache(data.indices.data(), data.indices.size(), vertexCount);
+    if (overdraw)
+        OptimizeOverdraw(data.indices.data(), data.indices.size(), data.positions.data(), vertexCount);
+    // Last, it follows the final triangle order
+    OptimizeVertexFetch(data);
+}
+
+/// @brief Clusters the vertices on a grid of gridSize cells along the largest extent, appending the remaining triangles to result
+static void ClusterVertices(const uint32_t * indices, const size_t indexCount, const vcm::VertexPos * positions, const vcm::Vec3 & min,
+    const float cellSize, std::vector<uint32_t> & result)
+{
+    struct Cell
+    {
+        float sum[3];
+        uint32_t count;
+        uint32_t representative;
+        float distance;
+    };
+    std::unordered_map<uint64_t, uint32_t> cellIndices;
+    std::vector<Cell> cells;
+    std::unordered_map<uint32_t, uint32_t> vertexCells;
+    const auto getCellKey = [&](const vcm::VertexPos & position) {
+        const uint64_t x = static_cast<uint64_t>((position.x - min.x) / cellSize);
+        const uint64_t y = static_cast<uint64_t>((position.y - min.y) / cellSize);
+        const uint64_t z = static_cast<uint64_t>((position.z - min.z) / cellSize);
+        return x | (y << 21) | (z << 42);
+    };
+
+    // Mean of each cell, then its closest vertex
+    for (size_t i = 0; i < indexCount; ++i) {
+        const uint32_t vertex = indices[i];
+        if (vertexCells.count(vertex))
+            continue;
+        auto [it, inserted] = cellIndices.try_emplace(getCellKey(positions[vertex]), static_cast<uint32_t>(cells.size()));
+        if (inserted)
+            cells.push_back({{0.0f, 0.0f, 0.0f}, 0, vertex, std::numeric_limits<float>::max()});
+        Cell & cell = cells[it->second];
+        cell.sum[0] += positions[vertex].x;
+        cell.sum[1] += positions[vertex].y;
+        cell.sum[2] += positions[vertex].z;
+        ++cell.count;
+        vertexCells.emplace(vertex, it->second);
+    }
+    for (const auto & [vertex, cellIndex] : vertexCells) {
+        Cell & cell = cells[cellIndex];
+        const float dx = positions[vertex].x - cell.sum[0] / static_cast<float>(cell.count);
+        const float dy = positions[vertex].y - cell.sum[1] / static_cast<float>(cell.count);
+        const float dz = positions[vertex].z - cell.sum[2] / static_cast<float>(cell.count);
+        const float distance = dx * dx + dy * dy + dz * dz;
+        // Ties broken on the index, for the same result whatever the map's order
+        if (distance < cell.distance || (distance == cell.distance && vertex < cell.representative)) {
+            cell.distance = distance;
+            cell.representative = vertex;
+        }
+    }
+
+    // Collapsed triangles are dropped, as well as the duplicates of a same triangle (rotated to start on its lowest index)
+    std::vector<std::array<uint32_t, 3>> triangles;
+    triangles.reserve(indexCount / 3);
+    for (size_t t = 0; t < indexCount / 3; ++t) {
+        std::array<uint32_t, 3> triangle;
+        for (size_t k = 0; k < 3; ++k)
+            triangle[k] = cells[vertexCells[indices[t * 3 + k]]].representative;
+        if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+            continue;
+        while (triangle[0] > triangle[1] || triangle[0] > triangle[2])
+            std::rotate(triangle.begin(), triangle.begin() + 1, triangle.end());
+        triangles.emplace_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+    result.clear();
+    for (const std::array<uint32_t, 3> & triangle : triangles)
+        result.insert(result.end(), triangle.begin(), triangle.end());
+}
+
+void MeshOptimizer::SimplifyClustered(const uint32_t * indices, const size_t indexCount, const vcm::VertexPos * positions, const uint32_t vertexCount,
+    const size_t targetIndexCount, std::vector<uint32_t> & result, float & error)
+{
+    VENOM_TRACE_FUNCTION();
+    result.clear();
+    error = 0.0f;
+    if (indexCount < 3 || vertexCount == 0)
+        return;
+
+    vcm::Vec3 min = positions[indices[0]];
+    vcm::Vec3 max = positions[indices[0]];
+    for (size_t i = 1; i < indexCount; ++i) {
+        const vcm::VertexPos & position = positions[indices[i]];
+        min.x = std::min(min.x, position.x);
+        min.y = std::min(min.y, position.y);
+        min.z = std::min(min.z, position.z);
+        max.x = std::max(max.x, position.x);
+        max.y = std::max(max.y, position.y);
+        max.z = std::max(max.z, position.z);
+    }
+    const float extent = std::max({max.x - min.x, max.y - min.y, max.z - min.z});
+    if (extent <= 0.0f)
+        return;
+
+    // The triangle count grows with the resolution: the finest grid within the target wins
+    constexpr uint32_t MAX_GRID_SIZE = 1024;
+    uint32_t low = 1;
+    uint32_t high = MAX_GRID_SIZE;
+    std::vector<uint32_t> candidate;
+    while (low <= high) {
+        const uint32_t gridSize = low + (high - low) / 2;
+        // Slightly larger cells, so the farthest vertices still fall in the last one
+        const float cellSize = extent / static_cast<float>(gridSize) * 1.0001f;
+        ClusterVertices(indices, indexCount, positions, min, cellSize, candidate);
+        if (candidate.size() <= targetIndexCount) {
+            if (candidate.size() > result.size() || result.empty()) {
+                result.swap(candidate);
+                error = 1.0f / static_cast<float>(gridSize);
+            }
+            low = gridSize + 1;
+        } else {
+            high = gridSize - 1;
+        }
+    }
+}
+
+void MeshOptimizer::GenerateLods(MeshData & data, const bool optimizeVertexCache)
+{
+    VENOM_TRACE_FUNCTION();
+    const uint32_t baseIndexCount = static_cast<uint32_t>(data.indices.size());
+    data.lods.assign(1, MeshLod{0, baseIndexCount, 0.0f});
+    if (baseIndexCount % 3 != 0 || baseIndexCount / 3 < MIN_LOD_TRIANGLE_COUNT)
+        return;
+
+    const uint32_t vertexCount = static_cast<uint32_t>(data.positions.size());
+    std::vector<uint32_t> lodIndices;
+    while (data.lods.size() < MAX_MESH_LOD_COUNT && data.lods.back().indexCount / 3 >= MIN_LOD_TRIANGLE_COUNT * 2) {
+        // Always from the full detail, errors don't pile up
+        float error;
+        SimplifyClustered(data.indices.data(), baseIndexCount, data.positions.data(), vertexCount,
+            data.lods.back().indexCount / 2, lodIndices, error);
+        if (lodIndices.size() / 3 < MIN_LOD_TRIANGLE_COUNT)
+            break;
+        if (optimizeVertexCache)
+            OptimizeVertexCache(lodIndices.data(), lodIndices.size(), vertexCount);
+        data.lods.push_back({static_cast<uint32_t>(data.indices.size()), static_cast<uint32_t>(lodIndices.size()), error});
+        data.indices.insert(data.indices.end(), lodIndices.begin(), lodIndices.end());
+    }
+}
+}
+}
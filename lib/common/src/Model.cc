@@ -6,19 +6,29 @@
 /// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
 ///
 #include <venom/common/plugin/graphics/Model.h>
+#include <venom/common/plugin/graphics/BakedModel.h>
+#include <venom/common/plugin/graphics/MeshOptimizer.h>
+#include <venom/common/BakedAsset.h>
+#include <venom/common/Config.h>
 
 #include <venom/common/VenomEngine.h>
 #include <venom/common/Resources.h>
 #include <venom/common/Log.h>
+#include <venom/common/Trace.h>
+#include <venom/common/ThreadPool.h>
 
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 #include <assimp/cimport.h>
 
+#include <algorithm>
 #include <iostream>
 #include <assimp/DefaultLogger.hpp>
 #include <filesystem>
+#include <future>
+#include <unordered_map>
 
 namespace venom
 {
@@ -105,201 +115,480 @@ static MaterialComponentType GetMaterialComponentTypeFromProperty(const std::str
     return MaterialComponentType::MAX_COMPONENT;
 }
 
-vc::Error Model::ImportModel(const std::string & path)
+/// @brief Texture files are decoded on the workers while the rest of the model is imported, one job per file
+class TextureLoader
 {
-    // Get Parent folder for relative paths when we will load textures
-    auto parentFolder = std::filesystem::path(path).parent_path();
+public:
+    ~TextureLoader()
+    {
+        // The jobs write into the pending textures
+        for (const auto & pending : __pendingTextures)
+            pending->decoded.wait();
+    }
+
+    /// @param path resolved path, as returned by Resources::GetTexturesResourcePath()
+    void Request(const std::string & path, Material * material, const MaterialComponentType type)
+    {
+        // Tries to load from cache, otherwise decoded in the background
+        if (Texture * texture = dynamic_cast<Texture *>(GraphicsPluginObject::GetCachedObject(path))) {
+            material->SetComponent(type, texture);
+            return;
+        }
+        auto [it, inserted] = __pendingTexturesByPath.try_emplace(path, nullptr);
+        if (inserted) {
+            PendingTexture * pending = __pendingTextures.emplace_back(std::make_unique<PendingTexture>()).get();
+            pending->path = path;
+            pending->decoded = ThreadPool::GetGlobalThreadPool()->Submit([pending]() {
+                return Texture::DecodeImageFile(pending->path, pending->image);
+            });
+            it->second = pending;
+        }
+        it->second->users.emplace_back(material, type);
+    }
+
+    /// @brief Creates the textures decoded meanwhile on this thread, in request order
+    void Finish()
+    {
+        VENOM_TRACE_ZONE("UploadTextures");
+        for (const auto & pending : __pendingTextures) {
+            // A missing texture isn't fatal, the material just doesn't get it
+            if (pending->decoded.get() != vc::Error::Success)
+                continue;
+            Texture * texture = Texture::CreateFromDecodedImage(pending->path, pending->image);
+            if (!texture)
+                continue;
+            for (const auto & [material, component] : pending->users)
+                material->SetComponent(component, texture);
+        }
+        __pendingTextures.clear();
+        __pendingTexturesByPath.clear();
+    }
+
+private:
+    struct PendingTexture
+    {
+        std::string path;
+        DecodedImage image;
+        std::future<vc::Error> decoded;
+        /// @brief Components waiting for the texture
+        std::vector<std::pair<Material *, MaterialComponentType>> users;
+    };
+    std::vector<std::unique_ptr<PendingTexture>> __pendingTextures;
+    std::unordered_map<std::string, PendingTexture *> __pendingTexturesByPath;
+};
+
+/// @brief Records every file the importer opens besides the source (.mtl, glTF buffers...), a bake is stale once any of them changes
+class DependencyRecorder : public Assimp::DefaultIOSystem
+{
+public:
+    explicit DependencyRecorder(const std::string & sourcePath)
+        : __sourcePath(sourcePath)
+    {
+    }
+
+    Assimp::IOStream * Open(const char * file, const char * mode) override
+    {
+        Assimp::IOStream * stream = DefaultIOSystem::Open(file, mode);
+        std::error_code ec;
+        if (stream && !std::filesystem::equivalent(file, __sourcePath, ec)
+            && std::find(__dependencies.begin(), __dependencies.end(), file) == __dependencies.end())
+            __dependencies.emplace_back(file);
+        return stream;
+    }
+
+    const std::vector<std::string> & GetDependencies() const { return __dependencies; }
+
+private:
+    std::string __sourcePath;
+    std::vector<std::string> __dependencies;
+};
 
+/// @brief Same post processing whether the model is imported or baked
+/// @param writer if not null, gets the hash of every other file the importer read
+static const aiScene * ReadScene(Assimp::Importer & importer, const std::string & path, BakedModelWriter * writer)
+{
     // Create Logger
     if (Assimp::DefaultLogger::isNullLogger())
         Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE, aiDefaultLogStream_STDOUT);
-    Assimp::Importer importer;
-    // Print cwd
+    // Owned by the importer
+    DependencyRecorder * recorder = writer ? new DependencyRecorder(path) : nullptr;
+    if (recorder)
+        importer.SetIOHandler(recorder);
     const aiScene* scene = importer.ReadFile(path.c_str(), aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals | aiProcess_CalcTangentSpace);
     if (!scene) {
         vc::Log::Error("Failed to load model: %s", path.c_str());
-        return vc::Error::Failure;
+        return nullptr;
+    }
+    if (recorder) {
+        // Stored relative to the source's folder, like texture paths
+        const std::filesystem::path sourceFolder = std::filesystem::path(path).parent_path();
+        for (const std::string & dependency : recorder->GetDependencies()) {
+            uint64_t hash;
+            if (BakedAsset::HashFile(dependency, hash) != vc::Error::Success) {
+                vc::Log::Error("Failed to hash model dependency: %s", dependency.c_str());
+                return nullptr;
+            }
+            std::error_code ec;
+            writer->AddDependency(std::filesystem::relative(dependency, sourceFolder.empty() ? "." : sourceFolder, ec).generic_string(), hash);
+        }
     }
+    return scene;
+}
 
-    // Load every material
-    if (scene->HasMaterials()) {
-        for (uint32_t i = 0; i < scene->mNumMaterials; ++i) {
-            auto material = vc::Material::Create();
-            __materials.push_back(material);
+/// @brief Reads the material's properties into material and/or writer
+/// @param material nullptr when only baking, textureLoader is then unused
+static void ImportMaterial(const aiMaterial * aimaterial, const std::filesystem::path & parentFolder, Material * material,
+    TextureLoader * textureLoader, BakedModelWriter * writer, const uint32_t bakedMaterial)
+{
+    // Iterate over all properties of the material
+    for (unsigned int p = 0; p < aimaterial->mNumProperties; ++p) {
+        aiMaterialProperty* property = aimaterial->mProperties[p];
+
+        // Property Key (name) and Type
+        auto propName = property->mKey.C_Str();
+        auto propType = property->mType;
+        auto propIndex = property->mIndex;
+        auto propSemantic = property->mSemantic;
+
+        // If propName is "?mat.name", it's the material name
+        if (strncmp(propName, "?mat.name", 9) == 0) {
+            aiString value;
+            memcpy(&value, property->mData, property->mDataLength);
+            if (material)
+                material->SetName(value.C_Str());
+            if (writer)
+                writer->SetMaterialName(bakedMaterial, value.C_Str());
+            continue;
+        }
 
-            const aiMaterial* aimaterial = scene->mMaterials[i];
-
-            // Iterate over all properties of the material
-            for (unsigned int p = 0; p < aimaterial->mNumProperties; ++p) {
-                aiMaterialProperty* property = aimaterial->mProperties[p];
-
-                // Property Key (name) and Type
-                auto propName = property->mKey.C_Str();
-                auto propType = property->mType;
-                auto propIndex = property->mIndex;
-                auto propSemantic = property->mSemantic;
-
-                // If propName is "?mat.name", it's the material name
-                if (strncmp(propName, "?mat.name", 9) == 0) {
-                    aiString value;
-                    memcpy(&value, property->mData, property->mDataLength);
-                    material->SetName(value.C_Str());
-                    continue;
-                }
-
-                MaterialComponentValueType valueType;
-                MaterialComponentType matCompType = GetMaterialComponentTypeFromProperty(property->mKey.C_Str(), property->mSemantic, property->mIndex, property->mDataLength, valueType);
-
-                if (matCompType == MaterialComponentType::MAX_COMPONENT) {
-                    vc::Log::Error("Unknown material component type: %s", property->mKey.C_Str());
-                    continue;
-                }
-
-                switch (valueType) {
-                    case MaterialComponentValueType::VALUE: {
-                        float value;
-                        memcpy(&value, property->mData, sizeof(float));
-                        material->SetComponent(matCompType, value);
-                        break;
-                    }
-                    case MaterialComponentValueType::COLOR3D: {
-                        aiColor3D value;
-                        memcpy(&value, property->mData, sizeof(aiColor3D));
-                        material->SetComponent(matCompType, vcm::Vec3(value.r, value.g, value.b));
-                        break;
-                    }
-                    case MaterialComponentValueType::COLOR4D: {
-                        aiColor4D value;
-                        memcpy(&value, property->mData, sizeof(aiColor4D));
-                        material->SetComponent(matCompType, vcm::Vec4(value.r, value.g, value.b, value.a));
-                        break;
-                    }
-                    case MaterialComponentValueType::TEXTURE: {
-                        aiString value;
-                        memcpy(&value, property->mData, property->mDataLength);
-                        // Tries to load from cache or path
-                        std::string texturePath = parentFolder / value.C_Str();
-                        Texture * texture = Texture::Create(texturePath.c_str());
-                        material->SetComponent(matCompType, texture);
-                        break;
-                    }
-                    default:
-                        break;
-                }
+        MaterialComponentValueType valueType;
+        MaterialComponentType matCompType = GetMaterialComponentTypeFromProperty(property->mKey.C_Str(), property->mSemantic, property->mIndex, property->mDataLength, valueType);
 
-#ifdef VENOM_DEBUG
-                Log::LogToFile("Property Name: %s", property->mKey.C_Str());
-                Log::LogToFile("Property Semantic: %d", property->mSemantic);
-                Log::LogToFile("Property Index: %d", property->mIndex);
-                Log::LogToFile("Property Data Length: %d", property->mDataLength);
-                Log::LogToFile("Property Type: %d", property->mType);
-
-                // Check property type
-                switch (property->mType) {
-                case aiPTI_Float:
-                        Log::LogToFile("Float\n");
-                        break;
-                case aiPTI_Integer:
-                        Log::LogToFile("Integer\n");
-                        break;
-                case aiPTI_String:
-                        Log::LogToFile("String\n");
-                        break;
-                case aiPTI_Buffer:
-                        Log::LogToFile("Buffer\n");
-                        break;
-                default:
-                        Log::LogToFile("Unknown\n");
-                }
-
-                // Handle different property types
-                if (property->mType == aiPTI_Float && property->mDataLength == sizeof(float)) {
-                    float value;
-                    memcpy(&value, property->mData, sizeof(float));
-                    Log::LogToFile("Float Value: %f\n", value);
-                } else if (property->mType == aiPTI_Integer && property->mDataLength == sizeof(int)) {
-                    int value;
-                    memcpy(&value, property->mData, sizeof(int));
-                    Log::LogToFile("Integer Value: %d\n", value);
-                } else if (property->mType == aiPTI_String) {
-                    aiString value;
-                    memcpy(&value, property->mData, property->mDataLength);
-                    Log::LogToFile("String Value: %s\n", value.C_Str());
-                }
-
-                Log::LogToFile("--------------------------------------------\n");
-#endif
+        if (matCompType == MaterialComponentType::MAX_COMPONENT) {
+            vc::Log::Error("Unknown material component type: %s", property->mKey.C_Str());
+            continue;
+        }
+
+        switch (valueType) {
+            case MaterialComponentValueType::VALUE: {
+                float value;
+                memcpy(&value, property->mData, sizeof(float));
+                if (material)
+                    material->SetComponent(matCompType, value);
+                if (writer)
+                    writer->AddMaterialValue(bakedMaterial, matCompType, valueType, &value);
+                break;
+            }
+            case MaterialComponentValueType::COLOR3D: {
+                aiColor3D value;
+                memcpy(&value, property->mData, sizeof(aiColor3D));
+                if (material)
+                    material->SetComponent(matCompType, vcm::Vec3(value.r, value.g, value.b));
+                if (writer)
+                    writer->AddMaterialValue(bakedMaterial, matCompType, valueType, &value.r);
+                break;
             }
+            case MaterialComponentValueType::COLOR4D: {
+                aiColor4D value;
+                memcpy(&value, property->mData, sizeof(aiColor4D));
+                if (material)
+                    material->SetComponent(matCompType, vcm::Vec4(value.r, value.g, value.b, value.a));
+                if (writer)
+                    writer->AddMaterialValue(bakedMaterial, matCompType, valueType, &value.r);
+                break;
+            }
+            case MaterialComponentValueType::TEXTURE: {
+                aiString value;
+                memcpy(&value, property->mData, property->mDataLength);
+                if (material)
+                    textureLoader->Request(Resources::GetTexturesResourcePath((parentFolder / value.C_Str()).string()), material, matCompType);
+                if (writer)
+                    writer->AddMaterialTexture(bakedMaterial, matCompType, value.C_Str());
+                break;
+            }
+            default:
+                break;
+        }
+
+#ifdef VENOM_DEBUG
+        Log::LogToFile("Property Name: %s", property->mKey.C_Str());
+        Log::LogToFile("Property Semantic: %d", property->mSemantic);
+        Log::LogToFile("Property Index: %d", property->mIndex);
+        Log::LogToFile("Property Data Length: %d", property->mDataLength);
+        Log::LogToFile("Property Type: %d", property->mType);
+
+        // Check property type
+        switch (property->mType) {
+        case aiPTI_Float:
+                Log::LogToFile("Float\n");
+                break;
+        case aiPTI_Integer:
+                Log::LogToFile("Integer\n");
+                break;
+        case aiPTI_String:
+                Log::LogToFile("String\n");
+                break;
+        case aiPTI_Buffer:
+                Log::LogToFile("Buffer\n");
+                break;
+        default:
+                Log::LogToFile("Unknown\n");
+        }
+
+        // Handle different property types
+        if (property->mType == aiPTI_Float && property->mDataLength == sizeof(float)) {
+            float value;
+            memcpy(&value, property->mData, sizeof(float));
+            Log::LogToFile("Float Value: %f\n", value);
+        } else if (property->mType == aiPTI_Integer && property->mDataLength == sizeof(int)) {
+            int value;
+            memcpy(&value, property->mData, sizeof(int));
+            Log::LogToFile("Integer Value: %d\n", value);
+        } else if (property->mType == aiPTI_String) {
+            aiString value;
+            memcpy(&value, property->mData, property->mDataLength);
+            Log::LogToFile("String Value: %s\n", value.C_Str());
         }
+
+        Log::LogToFile("--------------------------------------------\n");
+#endif
     }
+}
 
-    // Load every mesh
-    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
-        auto mesh = vc::Mesh::Create();
-        __meshes.push_back(mesh);
+/// @brief Reorders the mesh for the GPU's caches as set in vc::Config, reporting the gain, then generates its LODs
+static void OptimizeMesh(const aiMesh * aimesh, MeshData & data)
+{
+    const Config::MeshOptimization optimization = Config::GetInstance()->GetMeshOptimization();
+    if (data.indices.empty())
+        return;
+    VENOM_TRACE_FUNCTION();
+    if (optimization != Config::MeshOptimization::None) {
+        const VertexCacheStatistics before = MeshOptimizer::AnalyzeVertexCache(data.indices.data(), data.indices.size(), static_cast<uint32_t>(data.positions.size()));
+        MeshOptimizer::Optimize(data, optimization == Config::MeshOptimization::Overdraw);
+        const VertexCacheStatistics after = MeshOptimizer::AnalyzeVertexCache(data.indices.data(), data.indices.size(), static_cast<uint32_t>(data.positions.size()));
+        vc::Log::Print("Mesh %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", aimesh->mName.C_Str(), before.acmr, after.acmr, before.atvr, after.atvr);
+    }
+    // Coarser index ranges over the same vertices, appended after the full detail
+    MeshOptimizer::GenerateLods(data, optimization != Config::MeshOptimization::None);
+    if (data.lods.size() > 1)
+        vc::Log::Print("Mesh %s: %zu LODs, %u -> %u triangles", aimesh->mName.C_Str(), data.lods.size(), data.lods.front().indexCount / 3, data.lods.back().indexCount / 3);
+}
 
-        const aiMesh* aimesh = scene->mMeshes[i];
+/// @brief Converts the attributes of aimesh then optimizes them, CPU only
+static void ConvertMesh(const aiMesh * aimesh, MeshData & data)
+{
+    // Vertices & normals
+    data.positions.reserve(aimesh->mNumVertices);
+    data.normals.reserve(aimesh->mNumVertices);
+    for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
+        data.positions.emplace_back(aimesh->mVertices[x].x, aimesh->mVertices[x].y, aimesh->mVertices[x].z);
+        data.normals.emplace_back(aimesh->mNormals[x].x, aimesh->mNormals[x].y, aimesh->mNormals[x].z);
+    }
 
-        // Assign material
-        mesh->SetMaterial(__materials[aimesh->mMaterialIndex]);
+    // Color sets
+    for (int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        if (!aimesh->HasVertexColors(c)) break;
 
-        // Vertices & normals
-        mesh->__positions.reserve(aimesh->mNumVertices);
-        mesh->__normals.reserve(aimesh->mNumVertices);
+        data.colors[c].reserve(aimesh->mNumVertices);
         for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-            mesh->__positions.emplace_back(aimesh->mVertices[x].x, aimesh->mVertices[x].y, aimesh->mVertices[x].z);
-            mesh->__normals.emplace_back(aimesh->mNormals[x].x, aimesh->mNormals[x].y, aimesh->mNormals[x].z);
+            data.colors[c].emplace_back(aimesh->mColors[c][x].r, aimesh->mColors[c][x].g, aimesh->mColors[c][x].b, aimesh->mColors[c][x].a);
         }
+    }
 
-        // Color sets
-        for (int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
-            if (!aimesh->HasVertexColors(c)) break;
+    // UV Texture Coords
+    for (int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+        if (!aimesh->HasTextureCoords(c)) break;
 
-            mesh->__colors[c].reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh->__colors[c].emplace_back(aimesh->mColors[c][x].r, aimesh->mColors[c][x].g, aimesh->mColors[c][x].b, aimesh->mColors[c][x].a);
-            }
+        data.uvs[c].reserve(aimesh->mNumVertices);
+        for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
+            data.uvs[c].emplace_back(aimesh->mTextureCoords[c][x].x, aimesh->mTextureCoords[c][x].y);
         }
+    }
 
-        // UV Texture Coords
-        for (int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
-            if (!aimesh->HasTextureCoords(c)) break;
+    // Tangents & Bitangents
+    if (aimesh->HasTangentsAndBitangents()) {
+        data.tangents.reserve(aimesh->mNumVertices);
+        data.bitangents.reserve(aimesh->mNumVertices);
+        for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
+            data.tangents.emplace_back(aimesh->mTangents[x].x, aimesh->mTangents[x].y, aimesh->mTangents[x].z);
+            data.bitangents.emplace_back(aimesh->mBitangents[x].x, aimesh->mBitangents[x].y, aimesh->mBitangents[x].z);
+        }
+    }
 
-            mesh->__uvs[c].reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh->__uvs[c].emplace_back(aimesh->mTextureCoords[c][x].x, aimesh->mTextureCoords[c][x].y);
-            }
+    // Faces
+    if (aimesh->HasFaces()) {
+        data.indices.reserve(aimesh->mNumFaces * 3);
+        for (uint32_t x = 0; x < aimesh->mNumFaces; ++x) {
+            data.indices.push_back(aimesh->mFaces[x].mIndices[0]);
+            data.indices.push_back(aimesh->mFaces[x].mIndices[1]);
+            data.indices.push_back(aimesh->mFaces[x].mIndices[2]);
         }
+    }
+
+    OptimizeMesh(aimesh, data);
+}
+
+vc::Error Model::ImportModel(const std::string & path)
+{
+    VENOM_TRACE_FUNCTION();
+    // Up to date baked copy of the source: Assimp is skipped entirely
+    uint64_t sourceHash = 0;
+    const bool baking = !Config::GetInstance()->GetBakedAssetDirectory().empty() && BakedAsset::HashFile(path, sourceHash) == vc::Error::Success;
+    const std::string bakedPath = baking ? BakedAsset::GetBakedPath(path, sourceHash, BAKED_MODEL_EXTENSION) : std::string();
+    if (baking) {
+        BakedModel baked;
+        if (baked.Open(bakedPath, path, sourceHash) == vc::Error::Success)
+            return __ImportBakedModel(path, baked);
+    }
+
+    BakedModelWriter writer;
+    if (auto err = __ImportSourceModel(path, baking ? &writer : nullptr); err != vc::Error::Success)
+        return err;
+    // Not fatal, the source is imported again next time
+    if (baking)
+        writer.Write(bakedPath, sourceHash);
+    return vc::Error::Success;
+}
 
-        // Tangents & Bitangents
-        if (aimesh->HasTangentsAndBitangents()) {
-            mesh->__tangents.reserve(aimesh->mNumVertices);
-            mesh->__bitangents.reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh->__tangents.emplace_back(aimesh->mTangents[x].x, aimesh->mTangents[x].y, aimesh->mTangents[x].z);
-                mesh->__bitangents.emplace_back(aimesh->mBitangents[x].x, aimesh->mBitangents[x].y, aimesh->mBitangents[x].z);
+vc::Error Model::__ImportBakedModel(const std::string & path, const BakedModel & baked)
+{
+    VENOM_TRACE_FUNCTION();
+    // Texture paths are relative to the source's folder
+    auto parentFolder = std::filesystem::path(path).parent_path();
+    TextureLoader textureLoader;
+
+    for (uint32_t i = 0; i < baked.GetMaterialCount(); ++i) {
+        auto material = vc::Material::Create();
+        __materials.push_back(material);
+        material->SetName(std::string(baked.GetMaterialName(i)));
+
+        uint32_t componentCount;
+        const BakedMaterialComponent * components = baked.GetMaterialComponents(i, componentCount);
+        for (uint32_t c = 0; c < componentCount; ++c) {
+            const BakedMaterialComponent & component = components[c];
+            const MaterialComponentType matCompType = static_cast<MaterialComponentType>(component.type);
+            switch (component.valueType) {
+                case MaterialComponentValueType::VALUE:
+                    material->SetComponent(matCompType, component.value[0]);
+                    break;
+                case MaterialComponentValueType::COLOR3D:
+                    material->SetComponent(matCompType, vcm::Vec3(component.value[0], component.value[1], component.value[2]));
+                    break;
+                case MaterialComponentValueType::COLOR4D:
+                    material->SetComponent(matCompType, vcm::Vec4(component.value[0], component.value[1], component.value[2], component.value[3]));
+                    break;
+                case MaterialComponentValueType::TEXTURE:
+                    textureLoader.Request(Resources::GetTexturesResourcePath((parentFolder / baked.GetTexturePath(component.textureIndex)).string()), material, matCompType);
+                    break;
+                default:
+                    break;
             }
         }
+    }
 
-        // Faces
-        if (aimesh->HasFaces()) {
-            mesh->__indices.reserve(aimesh->mNumFaces * 3);
-            for (uint32_t x = 0; x < aimesh->mNumFaces; ++x) {
-                mesh->__indices.push_back(aimesh->mFaces[x].mIndices[0]);
-                mesh->__indices.push_back(aimesh->mFaces[x].mIndices[1]);
-                mesh->__indices.push_back(aimesh->mFaces[x].mIndices[2]);
+    // Vertex streams are copied from the mapping straight into staging memory, no CPU copy is kept
+    {
+        VENOM_TRACE_ZONE("UploadMeshes");
+        for (uint32_t i = 0; i < baked.GetMeshCount(); ++i) {
+            auto mesh = vc::Mesh::Create();
+            __meshes.push_back(mesh);
+            mesh->SetMaterial(__materials[baked.GetMesh(i).materialIndex]);
+            if (auto err = mesh->__LoadMesh(baked.GetMeshStreams(i)); err != vc::Error::Success) {
+                vc::Log::Error("Failed to load baked mesh");
+                return err;
             }
         }
+    }
+
+    textureLoader.Finish();
+    return vc::Error::Success;
+}
+
+vc::Error Model::__ImportSourceModel(const std::string & path, BakedModelWriter * writer)
+{
+    VENOM_TRACE_FUNCTION();
+    // Get Parent folder for relative paths when we will load textures
+    auto parentFolder = std::filesystem::path(path).parent_path();
 
-        // Load mesh into Graphics API
-        if (auto err = mesh->__LoadMeshFromCurrentData(); err != vc::Error::Success) {
-            vc::Log::Error("Failed to load mesh from current data");
-            return err;
+    Assimp::Importer importer;
+    const aiScene* scene = ReadScene(importer, path, writer);
+    if (!scene)
+        return vc::Error::Failure;
+
+    TextureLoader textureLoader;
+
+    // Load every material
+    if (scene->HasMaterials()) {
+        for (uint32_t i = 0; i < scene->mNumMaterials; ++i) {
+            auto material = vc::Material::Create();
+            __materials.push_back(material);
+            ImportMaterial(scene->mMaterials[i], parentFolder, material, &textureLoader, writer, writer ? writer->AddMaterial() : 0);
         }
     }
+
+    // Meshes are created up front, the Graphics API objects aren't thread safe
+    const size_t firstMesh = __meshes.size();
+    __meshes.reserve(firstMesh + scene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        auto mesh = vc::Mesh::Create();
+        __meshes.push_back(mesh);
+        // Assign material
+        mesh->SetMaterial(__materials[scene->mMeshes[i]->mMaterialIndex]);
+    }
+
+    // CPU conversion of every mesh in parallel, each job only writes its own meshes
+    {
+        VENOM_TRACE_ZONE("ConvertMeshes");
+        ThreadPool::GetGlobalThreadPool()->ParallelFor(scene->mNumMeshes, 1, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i)
+                ConvertMesh(scene->mMeshes[i], __meshes[firstMesh + i]->__data);
+        });
+    }
+
+    // Load meshes into Graphics API, every copy is recorded into the same upload batches
+    {
+        VENOM_TRACE_ZONE("UploadMeshes");
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            Mesh * mesh = __meshes[firstMesh + i];
+            if (auto err = mesh->__LoadMeshFromCurrentData(); err != vc::Error::Success) {
+                vc::Log::Error("Failed to load mesh from current data");
+                return err;
+            }
+            // Baked as uploaded
+            if (writer)
+                writer->AddMesh(scene->mMeshes[i]->mMaterialIndex, mesh->__data.GetStreams());
+        }
+    }
+
+    textureLoader.Finish();
     return vc::Error::Success;
 }
 
+vc::Error Model::BakeModel(const std::string & sourcePath, const std::string & bakedPath, const uint64_t sourceHash)
+{
+    VENOM_TRACE_FUNCTION();
+    BakedModelWriter writer;
+    Assimp::Importer importer;
+    const aiScene* scene = ReadScene(importer, sourcePath, &writer);
+    if (!scene)
+        return vc::Error::Failure;
+
+    // Texture paths are baked as found, relative to the source's folder
+    if (scene->HasMaterials()) {
+        for (uint32_t i = 0; i < scene->mNumMaterials; ++i)
+            ImportMaterial(scene->mMaterials[i], {}, nullptr, nullptr, &writer, writer.AddMaterial());
+    }
+
+    std::vector<MeshData> meshes(scene->mNumMeshes);
+    ThreadPool::GetGlobalThreadPool()->ParallelFor(scene->mNumMeshes, 1, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+            ConvertMesh(scene->mMeshes[i], meshes[i]);
+    });
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
+        writer.AddMesh(scene->mMeshes[i]->mMaterialIndex, meshes[i].GetStreams());
+    return writer.Write(bakedPath, sourceHash);
+}
+
 const std::vector<vc::Mesh*>& Model::GetMeshes() const
 {
     return __meshes;
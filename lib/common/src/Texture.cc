@@ -9,13 +9,83 @@
 #include <stb_image.h>
 
 #include <venom/common/plugin/graphics/Texture.h>
+#include <venom/common/BakedAsset.h>
+#include <venom/common/Config.h>
 #include <venom/common/Log.h>
 #include <venom/common/Resources.h>
+#include <venom/common/Trace.h>
 
 namespace venom
 {
 namespace common
 {
+/// @brief Baked image layout: header then tightly packed RGBA8 rows, native endianness
+struct BakedImageHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    /// @brief Hash of the source file the image was baked from
+    uint64_t sourceHash;
+    uint32_t width;
+    uint32_t height;
+    /// @brief Channels of the source, the pixels are always RGBA8
+    uint32_t channels;
+    uint32_t padding;
+};
+
+static constexpr uint32_t BAKED_IMAGE_MAGIC = 0x58544E56; // "VNTX"
+/// @brief To bump on any layout change, older bakes are then rebaked
+static constexpr uint32_t BAKED_IMAGE_VERSION = 1;
+
+static uint64_t GetImageSize(const DecodedImage & image)
+{
+    return static_cast<uint64_t>(image.width) * static_cast<uint64_t>(image.height) * 4;
+}
+
+static Error DecodeSourceImage(const std::string & path, DecodedImage & image)
+{
+    unsigned char * pixels = stbi_load(path.c_str(), &image.width, &image.height, &image.channels, STBI_rgb_alpha);
+    if (!pixels) {
+        vc::Log::Error("Failed to load image from file: %s", path.c_str());
+        return vc::Error::Failure;
+    }
+    image.decodedPixels = {pixels, stbi_image_free};
+    image.pixels = pixels;
+    return vc::Error::Success;
+}
+
+static Error LoadBakedImage(const std::string & bakedPath, const uint64_t sourceHash, DecodedImage & image)
+{
+    // Not baked yet
+    if (image.mapping.Open(bakedPath) != vc::Error::Success)
+        return vc::Error::Failure;
+    const BakedImageHeader * header = reinterpret_cast<const BakedImageHeader *>(image.mapping.GetData());
+    if (image.mapping.GetSize() < sizeof(BakedImageHeader) || header->magic != BAKED_IMAGE_MAGIC || header->version != BAKED_IMAGE_VERSION
+        || header->sourceHash != sourceHash
+        || image.mapping.GetSize() - sizeof(BakedImageHeader) < static_cast<uint64_t>(header->width) * header->height * 4) {
+        vc::Log::Print("Ignoring baked image: %s", bakedPath.c_str());
+        image.mapping.Close();
+        return vc::Error::Failure;
+    }
+    image.width = static_cast<int>(header->width);
+    image.height = static_cast<int>(header->height);
+    image.channels = static_cast<int>(header->channels);
+    image.pixels = image.mapping.GetData() + sizeof(BakedImageHeader);
+    return vc::Error::Success;
+}
+
+static Error WriteBakedImage(const std::string & bakedPath, const uint64_t sourceHash, const DecodedImage & image)
+{
+    BakedImageHeader header{};
+    header.magic = BAKED_IMAGE_MAGIC;
+    header.version = BAKED_IMAGE_VERSION;
+    header.sourceHash = sourceHash;
+    header.width = static_cast<uint32_t>(image.width);
+    header.height = static_cast<uint32_t>(image.height);
+    header.channels = static_cast<uint32_t>(image.channels);
+    return BakedAsset::WriteFile(bakedPath, {{&header, sizeof(header)}, {image.pixels, GetImageSize(image)}});
+}
+
 Texture::Texture()
     : GraphicsPluginObject()
 {
@@ -45,19 +115,62 @@ Texture* Texture::Create(const std::string & path)
     return texture;
 }
 
-vc::Error Texture::LoadImageFromFile(const char* path)
+vc::Error Texture::DecodeImageFile(const std::string & path, DecodedImage & image)
 {
-    int width, height, channels;
-    unsigned char * pixels = stbi_load(path, &width, &height, &channels, STBI_rgb_alpha);
-    if (!pixels) {
-        vc::Log::Error("Failed to load image from file: %s", path);
+    VENOM_TRACE_FUNCTION();
+    uint64_t sourceHash = 0;
+    const bool baking = !Config::GetInstance()->GetBakedAssetDirectory().empty() && BakedAsset::HashFile(path, sourceHash) == vc::Error::Success;
+    const std::string bakedPath = baking ? BakedAsset::GetBakedPath(path, sourceHash, BAKED_TEXTURE_EXTENSION) : std::string();
+    // Up to date baked copy: nothing to decode, the pixels are read from the mapping
+    if (baking && LoadBakedImage(bakedPath, sourceHash, image) == vc::Error::Success)
+        return vc::Error::Success;
+    if (DecodeSourceImage(path, image) != vc::Error::Success)
         return vc::Error::Failure;
+    // Not fatal, the source is decoded again next time
+    if (baking)
+        WriteBakedImage(bakedPath, sourceHash, image);
+    return vc::Error::Success;
+}
+
+vc::Error Texture::BakeImageFile(const std::string & sourcePath, const std::string & bakedPath, const uint64_t sourceHash)
+{
+    VENOM_TRACE_FUNCTION();
+    DecodedImage image;
+    if (DecodeSourceImage(sourcePath, image) != vc::Error::Success)
+        return vc::Error::Failure;
+    return WriteBakedImage(bakedPath, sourceHash, image);
+}
+
+vc::Error Texture::OpenBakedImage(const std::string & bakedPath, const uint64_t sourceHash, DecodedImage & image)
+{
+    return LoadBakedImage(bakedPath, sourceHash, image);
+}
+
+Texture* Texture::CreateFromDecodedImage(const std::string & path, const DecodedImage & image)
+{
+    // Same file referenced by several imports
+    if (Texture * texture = dynamic_cast<Texture *>(GetCachedObject(path)))
+        return texture;
+    Texture * texture = GraphicsPlugin::Get()->CreateTexture();
+    if (texture->__LoadImage(image.pixels, image.width, image.height, image.channels) != vc::Error::Success) {
+        vc::Log::Error("Failed to load image from file: %s", path.c_str());
+        texture->Destroy();
+        return nullptr;
     }
-    if (__LoadImage(pixels, width, height, channels) != vc::Error::Success) {
+    _SetInCache(path, texture);
+    return texture;
+}
+
+vc::Error Texture::LoadImageFromFile(const char* path)
+{
+    VENOM_TRACE_FUNCTION();
+    DecodedImage image;
+    if (DecodeImageFile(path, image) != vc::Error::Success)
+        return vc::Error::Failure;
+    if (__LoadImage(image.pixels, image.width, image.height, image.channels) != vc::Error::Success) {
         vc::Log::Error("Failed to load image from file: %s", path);
         return vc::Error::Failure;
     }
-    stbi_image_free(pixels);
     return vc::Error::Success;
 }
 
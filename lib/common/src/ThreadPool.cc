@@ -0,0 +1,128 @@
+///
+/// Project: VenomEngine
+/// @file ThreadPool.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/ThreadPool.h>
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace venom
+{
+namespace common
+{
+static thread_local const ThreadPool * t_workerPool = nullptr;
+static thread_local uint32_t t_workerIndex = 0;
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+    : __stopping(false)
+{
+    if (threadCount == 0) {
+        // hardware_concurrency() may return 0 when unknown
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+    __workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i)
+        __workers.emplace_back(&ThreadPool::__WorkerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(__mutex);
+        __stopping = true;
+    }
+    __condition.notify_all();
+    for (auto & worker : __workers)
+        worker.join();
+}
+
+size_t ThreadPool::ParallelFor(const size_t count, const size_t minBatchSize, const std::function<void(size_t, size_t, size_t)>& function)
+{
+    if (count == 0)
+        return 0;
+    // Workers + calling thread
+    const size_t maxBatches = __workers.size() + 1;
+    const size_t targetBatchCount = std::clamp<size_t>(count / std::max<size_t>(minBatchSize, 1), 1, maxBatches);
+    const size_t batchSize = (count + targetBatchCount - 1) / targetBatchCount;
+    // Rounding the size up may leave the last target batches empty
+    const size_t batchCount = (count + batchSize - 1) / batchSize;
+
+    // Batches go to whoever claims them first. The queue is shared with long jobs (decodes, compiles, file writes),
+    // so the calling thread keeps claiming batches itself and only ever waits on the ones a worker already started
+    struct SharedState
+    {
+        std::atomic<size_t> nextBatch = 0;
+        size_t doneBatchCount = 0;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+    // Outlives the call for the helper jobs still queued, which then find nothing left to claim
+    auto state = std::make_shared<SharedState>();
+    auto runBatches = [state, &function, count, batchSize, batchCount]() {
+        for (size_t batch = state->nextBatch++; batch < batchCount; batch = state->nextBatch++) {
+            const size_t begin = batch * batchSize;
+            function(begin, std::min(count, begin + batchSize), batch);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (++state->doneBatchCount == batchCount)
+                state->condition.notify_all();
+        }
+    };
+    for (size_t helper = 1; helper < batchCount; ++helper)
+        __Enqueue(runBatches);
+    runBatches();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state, batchCount]() { return state->doneBatchCount == batchCount; });
+    return batchCount;
+}
+
+uint32_t ThreadPool::GetThreadCount() const
+{
+    return static_cast<uint32_t>(__workers.size());
+}
+
+int32_t ThreadPool::GetWorkerIndex() const
+{
+    return t_workerPool == this ? static_cast<int32_t>(t_workerIndex) : -1;
+}
+
+ThreadPool* ThreadPool::GetGlobalThreadPool()
+{
+    static ThreadPool instance;
+    return &instance;
+}
+
+void ThreadPool::__Enqueue(std::function<void()>&& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(__mutex);
+        __jobs.emplace(std::move(job));
+    }
+    __condition.notify_one();
+}
+
+void ThreadPool::__WorkerLoop(const uint32_t workerIndex)
+{
+    t_workerPool = this;
+    t_workerIndex = workerIndex;
+    Trace::SetThreadName("Worker");
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(__mutex);
+            __condition.wait(lock, [this]() { return __stopping || !__jobs.empty(); });
+            if (__stopping && __jobs.empty())
+                return;
+            job = std::move(__jobs.front());
+            __jobs.pop();
+        }
+        job();
+    }
+}
+}
+}
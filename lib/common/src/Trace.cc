@@ -0,0 +1,169 @@
+///
+/// Project: VenomEngine
+/// @file Trace.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/Trace.h>
+#include <venom/common/Log.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace venom
+{
+namespace common
+{
+/// @brief Zones per thread between two flushes
+static constexpr uint64_t TRACE_BUFFER_CAPACITY = 1 << 14;
+
+struct ThreadTraceBuffer
+{
+    TraceEvent events[TRACE_BUFFER_CAPACITY];
+    // Written by the owning thread only
+    std::atomic<uint64_t> head = 0;
+    // Written by Flush() only
+    std::atomic<uint64_t> tail = 0;
+    std::atomic<uint64_t> dropped = 0;
+    std::atomic<const char *> name = nullptr;
+    bool nameWritten = false;
+    uint32_t threadId = 0;
+};
+
+std::atomic<bool> Trace::s_enabled = false;
+
+// Buffers outlive their threads, the registry is only locked once per thread and by Flush()
+static std::mutex s_registryMutex;
+static std::vector<std::unique_ptr<ThreadTraceBuffer>> s_buffers;
+static thread_local ThreadTraceBuffer * t_buffer = nullptr;
+static thread_local const char * t_threadName = nullptr;
+
+static std::mutex s_fileMutex;
+static FILE * s_file = nullptr;
+static bool s_firstEvent = true;
+static uint64_t s_epoch = 0;
+
+static ThreadTraceBuffer * GetThreadBuffer()
+{
+    if (!t_buffer) {
+        auto buffer = std::make_unique<ThreadTraceBuffer>();
+        buffer->name.store(t_threadName, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(s_registryMutex);
+        buffer->threadId = static_cast<uint32_t>(s_buffers.size());
+        t_buffer = buffer.get();
+        s_buffers.emplace_back(std::move(buffer));
+    }
+    return t_buffer;
+}
+
+static void WriteSeparator()
+{
+    fputs(s_firstEvent ? "\n" : ",\n", s_file);
+    s_firstEvent = false;
+}
+
+Error Trace::Begin(const char* path)
+{
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (s_file) {
+        Log::Error("Trace::Begin() : capture already running");
+        return Error::InvalidUse;
+    }
+    s_file = fopen(path, "w");
+    if (!s_file) {
+        Log::Error("Failed to open trace file: %s", path);
+        return Error::Failure;
+    }
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", s_file);
+    s_firstEvent = true;
+    s_epoch = Now();
+    {
+        // Forget zones left from a previous capture
+        std::lock_guard<std::mutex> registryLock(s_registryMutex);
+        for (auto & buffer : s_buffers) {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->nameWritten = false;
+        }
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+    return Error::Success;
+}
+
+void Trace::Flush()
+{
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (!s_file)
+        return;
+    std::lock_guard<std::mutex> registryLock(s_registryMutex);
+    for (auto & buffer : s_buffers) {
+        const char * name = buffer->name.load(std::memory_order_acquire);
+        if (name && !buffer->nameWritten) {
+            WriteSeparator();
+            fprintf(s_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", buffer->threadId, name);
+            buffer->nameWritten = true;
+        }
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        for (; tail < head; ++tail) {
+            const TraceEvent & event = buffer->events[tail % TRACE_BUFFER_CAPACITY];
+            // Zones begun before the capture
+            if (event.begin < s_epoch)
+                continue;
+            WriteSeparator();
+            fprintf(s_file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                event.name, buffer->threadId, (event.begin - s_epoch) / 1000.0, (event.end - event.begin) / 1000.0);
+        }
+        buffer->tail.store(head, std::memory_order_release);
+    }
+}
+
+void Trace::End()
+{
+    s_enabled.store(false, std::memory_order_relaxed);
+    Flush();
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (!s_file)
+        return;
+    fputs("\n]}\n", s_file);
+    fclose(s_file);
+    s_file = nullptr;
+
+    std::lock_guard<std::mutex> registryLock(s_registryMutex);
+    uint64_t dropped = 0;
+    for (auto & buffer : s_buffers)
+        dropped += buffer->dropped.exchange(0);
+    if (dropped > 0)
+        Log::Print("Trace: %" PRIu64 " zones dropped, flush more often", dropped);
+}
+
+void Trace::SetThreadName(const char* name)
+{
+    // Threads get their buffer on their first zone of a capture, none is allocated while tracing is off
+    t_threadName = name;
+    if (t_buffer)
+        t_buffer->name.store(name, std::memory_order_release);
+}
+
+uint64_t Trace::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Trace::Push(const TraceEvent& event)
+{
+    ThreadTraceBuffer * buffer = GetThreadBuffer();
+    const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire) >= TRACE_BUFFER_CAPACITY) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->events[head % TRACE_BUFFER_CAPACITY] = event;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+}
+}
@@ -11,6 +11,7 @@
 #include <venom/common/Log.h>
 #include <venom/common/MemoryPool.h>
 #include <venom/common/Resources.h>
+#include <venom/common/Trace.h>
 #include <venom/common/plugin/graphics/GraphicsApplication.h>
 
 #include <filesystem>
@@ -57,6 +58,10 @@ Error VenomEngine::RunEngine(char** argv)
 
     vc::Resources::InitializeFilesystem(argv);
 
+    const std::string & tracePath = Config::GetInstance()->GetTraceOutputPath();
+    if (!tracePath.empty() && Trace::Begin(tracePath.c_str()) == Error::Success)
+        Trace::SetThreadName("Main");
+
     s_instance.reset(new VenomEngine());
     vc::GraphicsApplication * app = vc::GraphicsApplication::Create();
 
@@ -67,8 +72,10 @@ Error VenomEngine::RunEngine(char** argv)
     {
         app->Loop();
         s_instance->pluginManager->CleanPluginsObjets();
+        Trace::Flush();
     }
     s_instance.reset();
+    Trace::End();
     vc::Resources::FreeFilesystem();
     return err;
 }
@@ -10,6 +10,7 @@
 #include <venom/common/MemoryPool.h>
 #include <venom/vulkan/Debug.h>
 
+#include <mutex>
 #include <unordered_map>
 
 namespace venom
@@ -29,6 +30,8 @@ public:
     int allocatedSize;
     int allocatedSizeMax;
     std::unordered_map<void *, size_t> allocations;
+    // Drivers may allocate from any thread creating objects
+    std::mutex mutex;
 };
 }
 }
\ No newline at end of file
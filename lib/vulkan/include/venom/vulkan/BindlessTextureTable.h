@@ -0,0 +1,90 @@
+///
+/// Project: VenomEngine
+/// @file BindlessTextureTable.h
+/// @date Oct, 16 2026
+/// @brief One large, partially bound array of sampled images indexed per material.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/DescriptorPool.h>
+#include <venom/vulkan/FrameSync.h>
+
+#include <deque>
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Every texture registers its image view into a single descriptor set (binding 0, SAMPLED_IMAGE array) and gets its index in it.
+/// Shaders declaring an unbounded array of textures get this set's layout, draws only push the index of their material's texture:
+/// the set is bound once per frame whatever the number of materials, and registrations are written once per frame in a single update.
+/// The binding is partially bound & update after bind, free slots may be written while frames using other slots are in flight.
+/// Unregistered slots are only reused once the frames that could sample them have completed.
+class BindlessTextureTable
+{
+public:
+    static constexpr const uint32_t INVALID_INDEX = UINT32_MAX;
+    /// @brief Size of the array, lowered to the device's limits
+    static constexpr const uint32_t MAX_TEXTURE_COUNT = 16384;
+
+    BindlessTextureTable();
+    ~BindlessTextureTable();
+    BindlessTextureTable(const BindlessTextureTable&) = delete;
+    BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    BindlessTextureTable(BindlessTextureTable&&) = delete;
+    BindlessTextureTable& operator=(BindlessTextureTable&&) = delete;
+
+    /// @brief The device must have been created with the descriptor indexing features of IsSupported()
+    vc::Error Init();
+    void Destroy();
+
+    /// @brief Fills the descriptor indexing features the table needs
+    /// @param supported features of the physical device
+    /// @param enabled features to create the logical device with
+    /// @return false if the device lacks any of them, enabled features are left untouched
+    static bool IsSupported(const VkPhysicalDeviceFeatures & supported, const VkPhysicalDeviceVulkan12Features & supported12,
+        VkPhysicalDeviceFeatures * enabled, VkPhysicalDeviceVulkan12Features * enabled12);
+    /// @brief False until Init(), textures are then bound through per draw descriptor sets
+    static bool IsEnabled();
+    /// @brief Thread safe, the descriptor is written by the next Update()
+    /// @return index of the view in the array, INVALID_INDEX if disabled or full
+    static uint32_t Register(VkImageView imageView);
+    /// @brief Thread safe, the view must outlive the frame being recorded
+    static void Unregister(const uint32_t index);
+    /// @brief Writes the registrations since the last call, to call once per frame before recording
+    static void Update();
+
+    static VkDescriptorSet GetVkDescriptorSet();
+    /// @brief Adds a reference to the layout of the table, for shaders declaring an unbounded array of textures
+    /// @return VK_NULL_HANDLE if disabled, to release with DeviceObjectCache::Release()
+    static VkDescriptorSetLayout AcquireDescriptorSetLayout();
+    static uint32_t GetCapacity();
+
+private:
+    VkDescriptorSetLayout __AcquireLayout() const;
+
+private:
+    struct RetiredSlot
+    {
+        uint32_t index;
+        FrameValue frame;
+    };
+
+    DescriptorPool __pool;
+    VkDescriptorSetLayout __layout;
+    VkDescriptorSet __set;
+    uint32_t __capacity;
+
+    std::mutex __mutex;
+    /// @brief Slots handed out so far, the array is filled from the start
+    uint32_t __slotCount;
+    std::vector<uint32_t> __freeSlots;
+    // Unregistered in frame order, reused from the front
+    std::deque<RetiredSlot> __retiredSlots;
+    std::vector<std::pair<uint32_t, VkImageView>> __pendingWrites;
+};
+}
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/vulkan/Debug.h>
+#include <venom/vulkan/DeviceMemoryAllocator.h>
 
 namespace venom
 {
@@ -26,8 +27,13 @@ public:
 
     vc::Error CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags flags, const VkSharingMode sharingMode, const VkMemoryPropertyFlags memoryProperties);
     vc::Error WriteBuffer(const void* data);
+    vc::Error WriteBuffer(const void* data, const VkDeviceSize size, const VkDeviceSize offset);
     VkBuffer GetVkBuffer() const;
     const VkDeviceMemory & GetVkDeviceMemory() const;
+    /// @brief Offset of the buffer inside its VkDeviceMemory
+    VkDeviceSize GetMemoryOffset() const;
+    /// @brief Persistently mapped pointer, nullptr if the memory isn't HOST_VISIBLE
+    void * GetMappedData() const;
     VkDeviceSize GetSize() const;
 
 private:
@@ -36,7 +42,7 @@ private:
 private:
     VkBufferCreateInfo __bufferCreateInfo;
     VkBuffer __buffer;
-    VkDeviceMemory __memory;
+    DeviceMemoryAllocation __allocation;
 };
 }
 }
\ No newline at end of file
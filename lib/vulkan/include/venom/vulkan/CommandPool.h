@@ -12,6 +12,8 @@
 #include <venom/vulkan/plugin/graphics/Model.h>
 #include <venom/vulkan/Buffer.h>
 #include <venom/vulkan/Image.h>
+#include <venom/vulkan/Semaphore.h>
+#include <venom/vulkan/GpuProfiler.h>
 
 #include <memory>
 
@@ -31,20 +33,31 @@ public:
     CommandPool();
     ~CommandPool();
     bool IsReady() const;
-    void SetQueue(Queue* queue);
+    void SetQueue(const Queue* queue);
     CommandPool(const CommandPool&) = delete;
     CommandPool& operator=(const CommandPool&) = delete;
     CommandPool(CommandPool&& other);
     CommandPool& operator=(CommandPool&& other);
 
-    vc::Error Init(QueueFamilyIndex queueFamilyIndex);
+    vc::Error Init(QueueFamilyIndex queueFamilyIndex, VkCommandPoolCreateFlags flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    /// @brief Allocates a command buffer owned by the pool for its whole lifetime
     vc::Error CreateCommandBuffer(CommandBuffer ** commandBuffer, VkCommandBufferLevel level = VkCommandBufferLevel::VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     vc::Error CreateSingleTimeCommandBuffer(SingleTimeCommandBuffer & commandBuffer);
+    /// @brief Hands out a command buffer valid until the next Reset(), recycled from the free list when possible
+    vc::Error AcquireCommandBuffer(CommandBuffer ** commandBuffer, VkCommandBufferLevel level = VkCommandBufferLevel::VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    /// @brief Resets the whole pool with vkResetCommandPool and puts acquired command buffers back in the free list.
+    /// The GPU must be done with every command buffer of the pool.
+    vc::Error Reset(VkCommandPoolResetFlags flags = 0);
+    uint32_t GetQueueFamilyIndex() const;
 
 private:
     VkCommandPool __commandPool;
+    uint32_t __queueFamilyIndex;
     std::vector<std::unique_ptr<CommandBuffer>> __commandBuffers;
-    Queue * __queue;
+    /// @brief Free/acquired lists of the recyclable command buffers, indexed by VkCommandBufferLevel
+    std::vector<CommandBuffer *> __freeCommandBuffers[2];
+    std::vector<CommandBuffer *> __acquiredCommandBuffers[2];
+    const Queue * __queue;
 };
 
 /// @brief Command Buffer class, only instanciable by VulkanCommandPool.
@@ -69,31 +82,52 @@ public:
 
 public:
     vc::Error BeginCommandBuffer(VkCommandBufferUsageFlags flags = 0);
+    /// @brief Begins a secondary command buffer continuing the render pass described by inheritanceInfo
+    vc::Error BeginSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo & inheritanceInfo, VkCommandBufferUsageFlags flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
     vc::Error EndCommandBuffer();
+    void ExecuteCommands(const std::vector<CommandBuffer *> & secondaryCommandBuffers) const;
 public:
     void Reset(VkCommandBufferResetFlags flags);
     void BindPipeline(VkPipeline pipeline, VkPipelineBindPoint bindPoint) const;
     void SetViewport(const VkViewport& viewport) const;
     void SetScissor(const VkRect2D& scissor) const;
     void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const;
-    void DrawMesh(const VulkanMesh * vulkanMesh) const;
-    void DrawModel(const VulkanModel * vulkanModel) const;
+    /// @param lod index range to draw, see vc::Mesh::SelectLod()
+    void DrawMesh(const VulkanMesh * vulkanMesh, const uint32_t lod = 0) const;
+    /// @brief Draws every mesh at the LOD its projected size selects from view
+    void DrawModel(const VulkanModel * vulkanModel, const vcm::Mat4 & transform, const vc::LodView & view) const;
+
+    /// @brief GPU timestamp scope, see GpuProfiler
+    GpuScopeId BeginGpuScope(const char * name) const;
+    void EndGpuScope(const GpuScopeId scope) const;
 
     void PushConstants(const ShaderPipeline * shaderPipeline, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void * pValues) const;
     void CopyBuffer(const Buffer& srcBuffer, const Buffer& dstBuffer);
     void CopyBufferToImage(const Buffer& srcBuffer, const Image& dstImage);
+    void CopyBufferToImage(const VkBuffer srcBuffer, const VkDeviceSize srcOffset, const Image& dstImage);
+    /// @brief srcImage must be in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, rows are tightly packed in dstBuffer
+    void CopyImageToBuffer(const Image& srcImage, const Buffer& dstBuffer);
     void TransitionImageLayout(Image& image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout);
+    /// @brief TRANSFER_DST to SHADER_READ_ONLY on a queue that may lack shader stages (transfer only), the copy is
+    /// made visible to shaders by the submission sampling the image waiting on this one's semaphore
+    void TransitionUploadedImage(Image& image);
 
+    /// @param dynamicOffsets one per dynamic buffer of the set, in binding order
     void BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
-        uint32_t firstSet, uint32_t descriptSetCount, VkDescriptorSet vkDescriptors);
+        uint32_t firstSet, uint32_t descriptSetCount, VkDescriptorSet vkDescriptors,
+        uint32_t dynamicOffsetCount = 0, const uint32_t * dynamicOffsets = nullptr);
 
     void SubmitToQueue(VkFence fence = VK_NULL_HANDLE, VkSemaphore waitSemaphore = VK_NULL_HANDLE, VkPipelineStageFlags waitStage = 0,
         VkSemaphore signalSemaphore = VK_NULL_HANDLE);
+    /// @brief Submits and sets timelineSemaphore's payload to signalValue once the GPU is done
+    vc::Error SubmitToQueue(const Semaphore & timelineSemaphore, const uint64_t signalValue);
     void WaitForQueue() const;
 protected:
     VkCommandBuffer _commandBuffer;
     const Queue * _queue;
     bool _isActive;
+    // Opened by RenderPass::BeginRenderPass, closed by RenderPass::EndRenderPass
+    GpuScopeId _renderPassScope;
 };
 
 class SingleTimeCommandBuffer : public CommandBuffer
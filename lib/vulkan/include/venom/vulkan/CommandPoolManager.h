@@ -11,6 +11,8 @@
 #include <venom/vulkan/CommandPool.h>
 
 #include <unordered_map>
+#include <mutex>
+#include <thread>
 
 namespace venom
 {
@@ -28,6 +30,9 @@ public:
     CommandPoolManager & operator=(CommandPoolManager && other) = delete;
 
     vc::Error Init();
+    /// @brief Prepares frameCount sets of transient graphics pools, one pool per recording thread (created on first use):
+    /// the calling thread, which renders the frames, and each worker of the global thread pool
+    vc::Error InitFrameCommandPools(const uint32_t frameCount);
 
     static CommandPool * GetGraphicsCommandPool();
     static CommandPool * GetComputeCommandPool();
@@ -38,6 +43,12 @@ public:
     static CommandPool * GetVideoDecodeCommandPool();
     static CommandPool * GetVideoEncodeCommandPool();
 
+    /// @brief Resets every pool of the frame, to call once the GPU is done with it (after its fence was waited on)
+    static vc::Error BeginFrame(const uint32_t frameIndex);
+    /// @brief Graphics pool of the current frame for the calling thread, command buffers acquired
+    /// from it are recycled at the next BeginFrame of the same frame index
+    static CommandPool * GetFrameCommandPool();
+
 private:
     static CommandPool * GetCommandPool(const QueueFamilyIndices & queueFamilyIndices);
 
@@ -52,6 +63,11 @@ private:
 
 private:
     std::unordered_map<uint32_t, CommandPool> __commandPools;
+    /// @brief Per frame and per thread pools: __framePools[frameIndex][0] for the render thread, [1 + workerIndex] for the workers
+    std::vector<std::vector<std::unique_ptr<CommandPool>>> __framePools;
+    std::thread::id __renderThreadId;
+    uint32_t __currentFrame;
+    std::mutex __framePoolsMutex;
 };
 }
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+///
+/// Project: VenomEngine
+/// @file DeletionQueue.h
+/// @date Oct, 16 2026
+/// @brief Defers the destruction of Vulkan handles until the GPU is done with them.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/DeviceMemoryAllocator.h>
+#include <venom/vulkan/FrameSync.h>
+#include <venom/vulkan/UploadManager.h>
+
+#include <deque>
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Handles given to the queue are destroyed once the frame being recorded when they were
+/// pushed and every upload batch recorded so far have completed on the GPU.
+/// Without a DeletionQueue alive (e.g. during the application's teardown), handles are destroyed right away.
+class DeletionQueue
+{
+public:
+    DeletionQueue();
+    ~DeletionQueue();
+    DeletionQueue(const DeletionQueue&) = delete;
+    DeletionQueue& operator=(const DeletionQueue&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    DeletionQueue(DeletionQueue&&) = delete;
+    DeletionQueue& operator=(DeletionQueue&&) = delete;
+
+    /// @brief Takes ownership of the allocation, which is reset
+    static void DestroyBuffer(VkBuffer buffer, DeviceMemoryAllocation * allocation);
+    /// @brief Takes ownership of the allocation, which is reset
+    static void DestroyImage(VkImage image, DeviceMemoryAllocation * allocation);
+    static void DestroyImageView(VkImageView imageView);
+    static void DestroySampler(VkSampler sampler);
+    static void DestroyPipeline(VkPipeline pipeline);
+    static void DestroyPipelineLayout(VkPipelineLayout pipelineLayout);
+    static void DestroyDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout);
+    static void DestroyFramebuffer(VkFramebuffer framebuffer);
+    /// @brief Push its framebuffers and image views first, handles are destroyed in push order
+    static void DestroySwapchain(VkSwapchainKHR swapchain);
+
+    /// @brief Destroys every handle whose frame retired, to call once per frame
+    static void Update();
+    /// @brief Waits for the device to be idle and destroys everything
+    static void Flush();
+
+private:
+    enum class HandleType
+    {
+        Buffer,
+        Image,
+        ImageView,
+        Sampler,
+        Pipeline,
+        PipelineLayout,
+        DescriptorSetLayout,
+        Framebuffer,
+        Swapchain
+    };
+
+    struct Entry
+    {
+        HandleType type;
+        uint64_t handle;
+        DeviceMemoryAllocation allocation;
+        FrameValue frame;
+        UploadHandle upload;
+    };
+
+    static void __Push(const HandleType type, const uint64_t handle, DeviceMemoryAllocation * allocation);
+    static void __Destroy(Entry & entry);
+    void __Flush();
+
+private:
+    // Pushed in frame order, retired from the front
+    std::deque<Entry> __entries;
+    std::mutex __mutex;
+};
+}
+}
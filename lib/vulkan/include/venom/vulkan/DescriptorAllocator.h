@@ -0,0 +1,64 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorAllocator.h
+/// @date Oct, 16 2026
+/// @brief Per frame linear allocator of transient descriptor sets over chained, recycled pools.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/DescriptorSet.h>
+
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Sets are never freed one by one: every pool a frame allocated from is reset as a whole once the GPU is done with the frame,
+/// and goes back to a free list shared by every frame. A full pool chains to the next one (recycled, or created twice as large),
+/// so allocating a set costs one vkAllocateDescriptorSets in steady state, and per draw or per material sets can't exhaust the pools.
+class DescriptorAllocator
+{
+public:
+    /// @brief Sets of the first pool, then doubled for every new pool
+    static constexpr const uint32_t MIN_SETS_PER_POOL = 64;
+    static constexpr const uint32_t MAX_SETS_PER_POOL = 4096;
+
+    DescriptorAllocator();
+    ~DescriptorAllocator();
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    DescriptorAllocator(DescriptorAllocator&&) = delete;
+    DescriptorAllocator& operator=(DescriptorAllocator&&) = delete;
+
+    /// @brief Prepares frameCount chains of pools, pools are created on first use
+    vc::Error Init(const uint32_t frameCount);
+    void Destroy();
+
+    /// @brief Resets every pool of the frame, to call once the GPU is done with it (after its fence was waited on)
+    static vc::Error BeginFrame(const uint32_t frameIndex);
+    /// @brief Thread safe, the set is valid until the next BeginFrame() of the same frame index
+    /// @return a null set on failure
+    static DescriptorSet AllocateFrameSet(VkDescriptorSetLayout layout);
+
+    /// @brief Pools created so far, in use or free
+    static size_t GetPoolCount();
+
+private:
+    /// @brief __mutex must be held
+    /// @return VK_NULL_HANDLE on failure
+    VkDescriptorPool __AcquirePool();
+
+private:
+    /// @brief Pools used by each frame, the last one is allocated from: __framePools[frameIndex]
+    std::vector<std::vector<VkDescriptorPool>> __framePools;
+    std::vector<VkDescriptorPool> __freePools;
+    uint32_t __currentFrame;
+    uint32_t __setsPerPool;
+    size_t __poolCount;
+    std::mutex __mutex;
+};
+}
+}
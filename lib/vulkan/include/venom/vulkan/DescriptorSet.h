@@ -17,6 +17,7 @@ namespace venom
 namespace vulkan
 {
 class DescriptorPool;
+class DescriptorAllocator;
 class DescriptorSet
 {
 public:
@@ -36,6 +37,7 @@ public:
     const VkDescriptorSet & GetVkDescriptorSet() const;
 private:
     friend class DescriptorPool;
+    friend class DescriptorAllocator;
     VkDescriptorSet __set;
 };
 }
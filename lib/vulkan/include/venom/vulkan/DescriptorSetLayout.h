@@ -13,6 +13,7 @@ namespace venom
 {
 namespace vulkan
 {
+/// @brief Layouts with the same bindings share the same VkDescriptorSetLayout (see DeviceObjectCache)
 class DescriptorSetLayout
 {
 public:
@@ -0,0 +1,45 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorUpdateTemplate.h
+/// @date Oct, 16 2026
+/// @brief Writes every descriptor of a set from one struct, for sets of a layout written over and over.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+#include <vector>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief The driver precomputes how to copy the struct into a set of the layout, updating a set is then a single call
+/// without any VkWriteDescriptorSet to fill. Buffers are read as VkDescriptorBufferInfo, images & samplers as VkDescriptorImageInfo.
+class DescriptorUpdateTemplate
+{
+public:
+    DescriptorUpdateTemplate();
+    ~DescriptorUpdateTemplate();
+    DescriptorUpdateTemplate(const DescriptorUpdateTemplate&) = delete;
+    DescriptorUpdateTemplate& operator=(const DescriptorUpdateTemplate&) = delete;
+    DescriptorUpdateTemplate(DescriptorUpdateTemplate&& other) noexcept;
+    DescriptorUpdateTemplate& operator=(DescriptorUpdateTemplate&& other) noexcept;
+
+    /// @param offset of the descriptor's info in the structs given to Update()
+    /// @param stride between array elements, 0 for tightly packed infos
+    void AddEntry(uint32_t binding, VkDescriptorType descriptorType, size_t offset, uint32_t descriptorCount = 1, size_t stride = 0);
+    vc::Error Create(VkDescriptorSetLayout layout);
+    void Destroy();
+
+    /// @brief Writes every entry of set from data
+    void Update(VkDescriptorSet set, const void * data) const;
+    bool IsCreated() const;
+
+private:
+    std::vector<VkDescriptorUpdateTemplateEntry> __entries;
+    VkDescriptorUpdateTemplate __template;
+};
+}
+}
@@ -0,0 +1,62 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorWriter.h
+/// @date Oct, 16 2026
+/// @brief Batches descriptor writes to any number of sets into a single vkUpdateDescriptorSets.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/DescriptorSet.h>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Writes are accumulated until Flush(), buffer & image infos are stored by the writer:
+/// nothing given to it has to outlive the call that added it, only the handles must be alive at Flush().
+/// Not thread safe, one writer per thread.
+class DescriptorWriter
+{
+public:
+    DescriptorWriter();
+    ~DescriptorWriter();
+    DescriptorWriter(const DescriptorWriter&) = delete;
+    DescriptorWriter& operator=(const DescriptorWriter&) = delete;
+    DescriptorWriter(DescriptorWriter&&) = default;
+    DescriptorWriter& operator=(DescriptorWriter&&) = default;
+
+    DescriptorWriter & WriteBuffer(VkDescriptorSet set, uint32_t binding, VkDescriptorType descriptorType,
+        VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range, uint32_t arrayElement = 0);
+    DescriptorWriter & WriteImage(VkDescriptorSet set, uint32_t binding, VkDescriptorType descriptorType,
+        VkImageView imageView, VkImageLayout imageLayout, uint32_t arrayElement = 0);
+    DescriptorWriter & WriteSampler(VkDescriptorSet set, uint32_t binding, VkSampler sampler, uint32_t arrayElement = 0);
+
+    DescriptorWriter & WriteBuffer(const DescriptorSet & set, uint32_t binding, const UniformBuffer & buffer,
+        uint32_t bufferOffset, uint32_t bufferRange, VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    DescriptorWriter & WriteTexture(const DescriptorSet & set, uint32_t binding, const VulkanTexture * texture,
+        VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE);
+    DescriptorWriter & WriteSampler(const DescriptorSet & set, uint32_t binding, const Sampler & sampler);
+
+    /// @brief Every write since the last Flush() in one vkUpdateDescriptorSets, then clears the writer
+    void Flush();
+    /// @brief Drops the pending writes, keeps the storage
+    void Clear();
+    size_t GetWriteCount() const;
+
+private:
+    struct PendingWrite
+    {
+        VkWriteDescriptorSet write;
+        // In __bufferInfos or __imageInfos, they may reallocate until Flush()
+        size_t infoIndex;
+        bool isImage;
+    };
+
+    std::vector<PendingWrite> __pendingWrites;
+    std::vector<VkDescriptorBufferInfo> __bufferInfos;
+    std::vector<VkDescriptorImageInfo> __imageInfos;
+    std::vector<VkWriteDescriptorSet> __writes;
+};
+}
+}
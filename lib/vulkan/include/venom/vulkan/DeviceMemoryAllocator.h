@@ -0,0 +1,129 @@
+///
+/// Project: VenomEngine
+/// @file DeviceMemoryAllocator.h
+/// @date Oct, 16 2026
+/// @brief Sub-allocates device memory from large per-memory-type blocks.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+class DeviceMemoryBlock;
+
+/// @brief Range of device memory handed out by the DeviceMemoryAllocator.
+/// Either a sub-range of a shared block or a dedicated VkDeviceMemory.
+struct DeviceMemoryAllocation
+{
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    uint32_t memoryTypeIndex = UINT32_MAX;
+    /// @brief Host pointer to the start of the allocation, nullptr if not HOST_VISIBLE
+    void * mappedData = nullptr;
+    /// @brief Owning block, nullptr for dedicated allocations
+    DeviceMemoryBlock * block = nullptr;
+
+    inline bool IsValid() const { return memory != VK_NULL_HANDLE; }
+    inline bool IsDedicated() const { return block == nullptr; }
+};
+
+/// @brief Usage statistics of a single memory heap.
+struct DeviceMemoryHeapStats
+{
+    uint32_t blockCount = 0;
+    uint32_t dedicatedAllocationCount = 0;
+    uint32_t allocationCount = 0;
+    /// @brief Bytes reserved from the driver (blocks + dedicated allocations)
+    VkDeviceSize reservedBytes = 0;
+    /// @brief Bytes actually handed out to resources
+    VkDeviceSize usedBytes = 0;
+};
+
+/// @brief One vkAllocateMemory of a given memory type, sub-allocated with a first-fit free list.
+class DeviceMemoryBlock
+{
+public:
+    DeviceMemoryBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size);
+    ~DeviceMemoryBlock();
+    DeviceMemoryBlock(const DeviceMemoryBlock&) = delete;
+    DeviceMemoryBlock& operator=(const DeviceMemoryBlock&) = delete;
+
+    vc::Error Init(const bool hostVisible);
+    bool Allocate(const VkDeviceSize size, const VkDeviceSize alignment, VkDeviceSize * offset);
+    void Free(const VkDeviceSize offset, const VkDeviceSize size);
+
+    bool IsEmpty() const;
+    VkDeviceMemory GetVkDeviceMemory() const;
+    VkDeviceSize GetSize() const;
+    VkDeviceSize GetUsedSize() const;
+    uint32_t GetMemoryTypeIndex() const;
+    void * GetMappedData() const;
+
+private:
+    VkDeviceMemory __memory;
+    VkDeviceSize __size;
+    VkDeviceSize __usedSize;
+    uint32_t __memoryTypeIndex;
+    void * __mappedData;
+    /// @brief Free ranges, offset -> size, kept coalesced
+    std::map<VkDeviceSize, VkDeviceSize> __freeRanges;
+};
+
+/// @brief Replaces one vkAllocateMemory per resource with sub-allocations from large blocks.
+/// Belongs to VulkanApplication and must be initialized right after the LogicalDevice.
+class DeviceMemoryAllocator
+{
+public:
+    DeviceMemoryAllocator();
+    ~DeviceMemoryAllocator();
+    DeviceMemoryAllocator(const DeviceMemoryAllocator&) = delete;
+    DeviceMemoryAllocator& operator=(const DeviceMemoryAllocator&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    DeviceMemoryAllocator(DeviceMemoryAllocator&&) = delete;
+    DeviceMemoryAllocator& operator=(DeviceMemoryAllocator&&) = delete;
+
+    /// @brief Initializes the allocator for the used physical device
+    /// @param blockSize preferred size of a block, clamped to 1/8 of the smallest heap it lives in
+    vc::Error Init(const VkDeviceSize blockSize = DEFAULT_BLOCK_SIZE);
+    void Destroy();
+
+    /// @brief Allocates memory matching the requirements
+    /// @param dedicated forces a dedicated VkDeviceMemory (large images, render targets)
+    static vc::Error Allocate(const VkMemoryRequirements & requirements, const VkMemoryPropertyFlags properties, const bool dedicated, DeviceMemoryAllocation * allocation);
+    static vc::Error AllocateForBuffer(const VkBuffer buffer, const VkMemoryPropertyFlags properties, DeviceMemoryAllocation * allocation);
+    static vc::Error AllocateForImage(const VkImage image, const VkMemoryPropertyFlags properties, DeviceMemoryAllocation * allocation);
+    static void Free(DeviceMemoryAllocation * allocation);
+
+    static uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+    static DeviceMemoryHeapStats GetHeapStats(const uint32_t heapIndex);
+    static uint32_t GetHeapCount();
+    static void LogStats();
+
+public:
+    static constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 64ull * 1024ull * 1024ull;
+    /// @brief Resources bigger than a block fraction get their own memory
+    static constexpr VkDeviceSize DEDICATED_THRESHOLD_DIVISOR = 2;
+
+private:
+    VkDeviceSize __GetBlockSize(const uint32_t memoryTypeIndex) const;
+    vc::Error __AllocateDedicated(const VkDeviceSize size, const uint32_t memoryTypeIndex, DeviceMemoryAllocation * allocation);
+
+private:
+    VkPhysicalDeviceMemoryProperties __memoryProperties;
+    VkDeviceSize __preferredBlockSize;
+    VkDeviceSize __bufferImageGranularity;
+    std::vector<std::unique_ptr<DeviceMemoryBlock>> __blocks[VK_MAX_MEMORY_TYPES];
+    DeviceMemoryHeapStats __heapStats[VK_MAX_MEMORY_HEAPS];
+    std::mutex __mutex;
+};
+}
+}
@@ -0,0 +1,104 @@
+///
+/// Project: VenomEngine
+/// @file DeviceObjectCache.h
+/// @date Oct, 16 2026
+/// @brief Hash-consed, reference counted samplers, descriptor set layouts and pipeline layouts.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Identical create infos give the same handle: comparing handles is enough to know if two layouts are compatible,
+/// and the number of objects is bounded by the number of distinct descriptions instead of the number of owners.
+/// Create infos are flattened field by field into the key (floats by bit pattern, no padding nor pointers) and hashed with FNV-1a,
+/// so the hash doesn't depend on the process. Keys are compared in full on lookup, collisions can't merge different objects.
+/// Every Acquire*() must be matched by a Release(), the last one hands the object to the DeletionQueue.
+class DeviceObjectCache
+{
+public:
+    DeviceObjectCache();
+    ~DeviceObjectCache();
+    DeviceObjectCache(const DeviceObjectCache&) = delete;
+    DeviceObjectCache& operator=(const DeviceObjectCache&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    DeviceObjectCache(DeviceObjectCache&&) = delete;
+    DeviceObjectCache& operator=(DeviceObjectCache&&) = delete;
+
+    /// @brief Destroys every object, whether released or not
+    void Destroy();
+
+    /// @brief Thread safe, pNext chains aren't supported
+    /// @return VK_NULL_HANDLE on failure
+    static VkSampler AcquireSampler(const VkSamplerCreateInfo & createInfo);
+    /// @brief Thread safe
+    /// @param bindings order doesn't matter
+    /// @param bindingFlags empty, or one per binding in the same order (chained as VkDescriptorSetLayoutBindingFlagsCreateInfo)
+    /// @return VK_NULL_HANDLE on failure
+    static VkDescriptorSetLayout AcquireDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding> & bindings, const VkDescriptorSetLayoutCreateFlags flags = 0,
+        const std::vector<VkDescriptorBindingFlags> & bindingFlags = {});
+    /// @brief Thread safe, setLayouts must come from AcquireDescriptorSetLayout(), the pipeline layout keeps them alive
+    /// @return VK_NULL_HANDLE on failure
+    static VkPipelineLayout AcquirePipelineLayout(const std::vector<VkDescriptorSetLayout> & setLayouts, const std::vector<VkPushConstantRange> & pushConstantRanges);
+    static void Release(VkSampler sampler);
+    static void Release(VkDescriptorSetLayout layout);
+    static void Release(VkPipelineLayout layout);
+
+    /// @brief Number of distinct objects alive
+    static size_t GetObjectCount();
+
+private:
+    enum class ObjectType : uint64_t
+    {
+        Sampler,
+        DescriptorSetLayout,
+        PipelineLayout
+    };
+
+    struct Key
+    {
+        // Object type first, then the create info's fields
+        std::vector<uint64_t> words;
+        uint64_t hash = 0;
+
+        bool operator==(const Key & other) const { return hash == other.hash && words == other.words; }
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key & key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    struct Entry
+    {
+        uint64_t handle;
+        uint32_t refCount;
+        // Descriptor set layouts referenced by a pipeline layout
+        std::vector<uint64_t> dependencies;
+    };
+
+    static Key __MakeKey(std::vector<uint64_t> && words);
+    /// @brief Adds a reference to the object of key, if it exists
+    /// @return its handle, 0 if not cached
+    uint64_t __Find(const Key & key);
+    void __Insert(Key && key, const uint64_t handle, std::vector<uint64_t> && dependencies);
+    /// @brief __mutex must be held
+    void __Release(const ObjectType type, const uint64_t handle);
+    static void __Destroy(const ObjectType type, const uint64_t handle, const bool deferred);
+
+private:
+    std::mutex __mutex;
+    std::unordered_map<Key, Entry, KeyHasher> __objects;
+    // Handles of different types may have the same value
+    std::map<std::pair<ObjectType, uint64_t>, Key> __keys;
+};
+}
+}
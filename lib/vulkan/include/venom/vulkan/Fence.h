@@ -25,6 +25,9 @@ public:
 
     vc::Error InitFence(const VkFenceCreateFlags flags = VkFenceCreateFlagBits::VK_FENCE_CREATE_SIGNALED_BIT);
     const VkFence * GetFence() const;
+    void Reset() const;
+    vc::Error Wait(const uint64_t timeout = UINT64_MAX) const;
+    bool IsSignaled() const;
 
 private:
     VkFence __fence;
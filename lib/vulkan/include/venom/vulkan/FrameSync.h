@@ -0,0 +1,80 @@
+///
+/// Project: VenomEngine
+/// @file FrameSync.h
+/// @date Oct, 16 2026
+/// @brief Frame pacing built on a timeline semaphore.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Semaphore.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <atomic>
+#include <vector>
+
+namespace venom
+{
+namespace vulkan
+{
+class CommandBuffer;
+
+/// @brief Value of the frame timeline, the GPU signals N once frame N is done. 0 means no frame.
+typedef uint64_t FrameValue;
+
+/// @brief One timeline semaphore tracks GPU progress for every frame, each submitted frame gets the
+/// next value. Systems that need to know when the GPU is done with a frame (deletion, readback, ...)
+/// only have to remember the FrameValue they were used in.
+/// Binary semaphores are still needed for the swap chain (acquire/present can't use timelines).
+class FrameSync
+{
+public:
+    FrameSync();
+    ~FrameSync();
+    FrameSync(const FrameSync&) = delete;
+    FrameSync& operator=(const FrameSync&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    FrameSync(FrameSync&&) = delete;
+    FrameSync& operator=(FrameSync&&) = delete;
+
+    /// @param presentable false in headless mode: no swap chain semaphores are created nor used
+    vc::Error Init(const uint32_t framesInFlight, const bool presentable = true);
+    void Destroy();
+
+    /// @brief Blocks until the GPU is done with the frame that last used the slot of the new frame
+    /// @return vc::Error::Failure on timeout
+    vc::Error BeginFrame(const uint64_t timeout = UINT64_MAX);
+    /// @brief Submits the frame: waits for the acquired image, signals the present semaphore and the frame value.
+    /// The frame value is only consumed on success, an aborted frame is started again by the next BeginFrame().
+    /// @param waitStage stage waiting for the acquired image
+    /// @param uploadSemaphore timeline of the uploads the frame reads, vertex input and shaders wait for it to reach uploadValue
+    vc::Error SubmitFrame(const Queue & queue, const CommandBuffer * commandBuffer, const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        const VkSemaphore uploadSemaphore = VK_NULL_HANDLE, const uint64_t uploadValue = 0);
+
+    /// @brief Binary semaphore signaled by vkAcquireNextImageKHR for the current frame
+    VkSemaphore GetImageAvailableSemaphore() const;
+    /// @brief Binary semaphore waited on by vkQueuePresentKHR for the current frame
+    VkSemaphore GetRenderFinishedSemaphore() const;
+
+    /// @brief Slot in [0, framesInFlight) of the frame being recorded, to index per frame resources
+    static uint32_t GetFrameIndex();
+    /// @brief Value the frame being recorded will signal
+    static FrameValue GetCurrentFrameValue();
+    /// @brief Last frame the GPU finished, queried from the device
+    static FrameValue GetCompletedFrameValue();
+    static bool IsFrameComplete(const FrameValue value);
+    static vc::Error WaitForFrame(const FrameValue value, const uint64_t timeout = UINT64_MAX);
+
+private:
+    Semaphore __timeline;
+    std::vector<Semaphore> __imageAvailableSemaphores;
+    std::vector<Semaphore> __renderFinishedSemaphores;
+    uint32_t __framesInFlight;
+    bool __presentable;
+    // Written by the render thread, read from any thread through GetCurrentFrameValue()
+    std::atomic<FrameValue> __lastSubmittedValue;
+    // Cached to avoid querying the device when the answer is already known, may be read from any thread
+    std::atomic<FrameValue> __lastCompletedValue;
+};
+}
+}
@@ -0,0 +1,115 @@
+///
+/// Project: VenomEngine
+/// @file GpuProfiler.h
+/// @date Oct, 16 2026
+/// @brief GPU timings of command buffer scopes with timestamp queries.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/FrameSync.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace venom
+{
+namespace vulkan
+{
+class CommandBuffer;
+
+/// @brief Scope returned by GpuProfiler::BeginScope(), to give back to GpuProfiler::EndScope()
+typedef uint32_t GpuScopeId;
+static constexpr GpuScopeId INVALID_GPU_SCOPE = UINT32_MAX;
+
+/// @brief Rolling statistics of a scope, in milliseconds
+struct GpuScopeStats
+{
+    std::string name;
+    double last;
+    double average;
+    double min;
+    double max;
+    uint64_t sampleCount;
+};
+
+/// @brief Each frame slot owns a range of a timestamp query pool. Scopes write a timestamp at their beginning and end,
+/// results are read when the slot comes back (framesInFlight frames later), the frame's timeline value guaranteeing
+/// they're available: the CPU never waits for them.
+/// Scopes with the same name are aggregated in a rolling window, whatever the frame or command buffer they come from.
+class GpuProfiler
+{
+public:
+    GpuProfiler();
+    ~GpuProfiler();
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    GpuProfiler(GpuProfiler&&) = delete;
+    GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+    /// @brief Stays disabled (every call is a no-op) if the queue can't write timestamps
+    vc::Error Init(const uint32_t framesInFlight, const Queue & queue, const uint32_t maxScopesPerFrame = DEFAULT_MAX_SCOPES_PER_FRAME);
+    void Destroy();
+
+    /// @brief Collects the results of the previous use of the frame slot, resets its queries and opens the "Frame" scope.
+    /// To record at the beginning of the frame's primary command buffer, outside of any render pass.
+    static void BeginFrame(const CommandBuffer * commandBuffer);
+    static void EndFrame(const CommandBuffer * commandBuffer);
+    /// @brief Thread safe, may be recorded in secondary command buffers of the current frame
+    /// @param name must outlive the frame (e.g. string literal)
+    /// @return INVALID_GPU_SCOPE if disabled or if the frame is out of queries
+    static GpuScopeId BeginScope(const CommandBuffer * commandBuffer, const char * name);
+    static void EndScope(const CommandBuffer * commandBuffer, const GpuScopeId scope);
+    static bool IsEnabled();
+
+    static std::vector<GpuScopeStats> GetStats();
+    static void LogStats();
+    static vc::Error WriteJSON(const char * path);
+
+public:
+    static constexpr uint32_t DEFAULT_MAX_SCOPES_PER_FRAME = 128;
+    /// @brief Frames kept per scope for the rolling statistics
+    static constexpr size_t ROLLING_WINDOW = 128;
+
+private:
+    struct FrameQueries
+    {
+        // 0 if nothing to collect
+        FrameValue frame = 0;
+        uint32_t firstQuery = 0;
+        std::atomic<uint32_t> scopeCount = 0;
+        std::vector<const char *> names;
+    };
+
+    struct ScopeHistory
+    {
+        std::vector<double> samples;
+        size_t next = 0;
+        uint64_t sampleCount = 0;
+        double last = 0.0;
+    };
+
+    void __Collect(FrameQueries & frame);
+    static GpuScopeStats __ComputeStats(const std::string & name, const ScopeHistory & history);
+
+private:
+    VkQueryPool __queryPool;
+    std::vector<std::unique_ptr<FrameQueries>> __frames;
+    FrameQueries * __currentFrame;
+    GpuScopeId __frameScope;
+    uint32_t __maxScopesPerFrame;
+    // Nanoseconds per tick
+    double __timestampPeriod;
+    uint64_t __timestampMask;
+    std::vector<uint64_t> __results;
+    std::vector<std::pair<const char *, double>> __frameTotals;
+    std::map<std::string, ScopeHistory, std::less<>> __history;
+};
+}
+}
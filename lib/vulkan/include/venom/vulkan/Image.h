@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/vulkan/Debug.h>
+#include <venom/vulkan/DeviceMemoryAllocator.h>
 
 namespace venom
 {
@@ -24,7 +25,7 @@ public:
     Image(Image&& image) noexcept;
     Image& operator=(Image&& image) noexcept;
 
-    vc::Error Load(unsigned char* pixels, int width, int height, int channels,
+    vc::Error Load(const unsigned char* pixels, int width, int height, int channels,
         VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
     vc::Error Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t width, uint32_t height);
     void SetImageLayout(VkImageLayout layout);
@@ -41,7 +42,7 @@ private:
     VkImageCreateInfo __imageInfo;
     VkImage __image;
     VkImageLayout __layout;
-    VkDeviceMemory __imageMemory;
+    DeviceMemoryAllocation __allocation;
     uint32_t __width, __height;
 };
 }
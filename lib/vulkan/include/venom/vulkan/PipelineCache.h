@@ -0,0 +1,51 @@
+///
+/// Project: VenomEngine
+/// @file PipelineCache.h
+/// @date Oct, 16 2026
+/// @brief VkPipelineCache shared by every pipeline, persisted to disk between runs.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+#include <string>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief One cache per logical device. The file is keyed by the device's vendor, id, driver version and pipeline cache UUID,
+/// so a driver update or another GPU starts from an empty cache instead of feeding the driver foreign data.
+/// vkCreate*Pipelines() may use it from any thread: pipeline caches are internally synchronized.
+class PipelineCache
+{
+public:
+    PipelineCache();
+    /// @brief Saves the cache if it was initialized
+    ~PipelineCache();
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    PipelineCache(PipelineCache&&) = delete;
+    PipelineCache& operator=(PipelineCache&&) = delete;
+
+    /// @brief Creates the cache, from the file in directory if there is a valid one
+    /// @param directory empty to keep the cache in memory only
+    vc::Error Init(const std::string & directory);
+    /// @brief Writes the cache to its file (through a temporary file, a crash can't leave a truncated cache)
+    vc::Error Save() const;
+    void Destroy();
+
+    /// @brief VK_NULL_HANDLE if not initialized, which Vulkan accepts as "no cache"
+    static VkPipelineCache GetVkPipelineCache();
+
+private:
+    bool __IsCompatible(const std::vector<char> & data) const;
+
+private:
+    VkPipelineCache __cache;
+    std::string __path;
+};
+}
+}
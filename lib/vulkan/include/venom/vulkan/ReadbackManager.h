@@ -0,0 +1,88 @@
+///
+/// Project: VenomEngine
+/// @file ReadbackManager.h
+/// @date Oct, 16 2026
+/// @brief Asynchronous copies of rendered frames back to the CPU.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+#include <venom/vulkan/Image.h>
+#include <venom/vulkan/FrameSync.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace venom
+{
+namespace vulkan
+{
+class CommandBuffer;
+
+/// @brief Pixels of a frame read back from the GPU, only valid during the callback
+struct ReadbackFrame
+{
+    const void * data;
+    uint32_t width;
+    uint32_t height;
+    size_t rowPitch;
+    VkFormat format;
+    FrameValue frame;
+};
+/// @brief Called from a worker thread of the global ThreadPool
+typedef std::function<void(const ReadbackFrame &)> ReadbackCallback;
+
+/// @brief Records image -> buffer copies at the end of frames into a small pool of persistently mapped buffers.
+/// The CPU never waits for the copy: once the frame's timeline value is reached, the buffer is handed to a
+/// ThreadPool job (user callback and/or PNG/raw file as set in vc::Config) and recycled when the job is done.
+class ReadbackManager
+{
+public:
+    ReadbackManager();
+    ~ReadbackManager();
+    ReadbackManager(const ReadbackManager&) = delete;
+    ReadbackManager& operator=(const ReadbackManager&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    ReadbackManager(ReadbackManager&&) = delete;
+    ReadbackManager& operator=(ReadbackManager&&) = delete;
+
+    /// @param maxSlots readback buffers allowed at once, the pool grows up to it before stalling on the oldest one
+    vc::Error Init(const uint32_t width, const uint32_t height, const uint32_t maxSlots);
+    void Destroy();
+
+    /// @brief Records the copy of image (rendered in the current frame, in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+    static vc::Error RecordReadback(CommandBuffer * commandBuffer, const Image & image);
+    /// @brief Dispatches the readbacks of completed frames and recycles processed buffers, to call once per frame
+    static void Update();
+    /// @brief Waits for every pending readback to be processed, the device must be idle or the frames submitted
+    static void Flush();
+    static void SetCallback(const ReadbackCallback & callback);
+    /// @brief True if readbacks have a destination: a callback or an output format in vc::Config
+    static bool IsEnabled();
+
+private:
+    struct Slot
+    {
+        Buffer buffer;
+        // Frame the copy was recorded in, 0 once dispatched or free
+        FrameValue frame = 0;
+        std::future<void> job;
+    };
+
+    vc::Error __AcquireSlot(Slot ** slot);
+    vc::Error __CreateSlot(Slot ** slot);
+    void __Dispatch(Slot & slot);
+    static bool __IsFree(Slot & slot);
+
+private:
+    std::vector<std::unique_ptr<Slot>> __slots;
+    uint32_t __width, __height;
+    uint32_t __maxSlots;
+    VkMemoryPropertyFlags __memoryProperties;
+    ReadbackCallback __callback;
+};
+}
+}
@@ -25,7 +25,10 @@ public:
     RenderPass& operator=(RenderPass&& other);
 
     vc::Error InitRenderPass(const SwapChain * swapChain);
-    vc::Error BeginRenderPass(SwapChain * swapChain, CommandBuffer * commandBuffer, int framebufferIndex);
+    /// @param contents VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the draws are recorded in secondary command buffers
+    vc::Error BeginRenderPass(SwapChain * swapChain, CommandBuffer * commandBuffer, int framebufferIndex, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
+    /// @brief Inheritance info for secondary command buffers executed inside this render pass
+    VkCommandBufferInheritanceInfo GetInheritanceInfo(const SwapChain * swapChain, int framebufferIndex) const;
     vc::Error EndRenderPass(CommandBuffer * commandBuffer);
     VkRenderPass GetRenderPass() const;
 
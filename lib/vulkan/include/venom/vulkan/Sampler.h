@@ -13,6 +13,7 @@ namespace venom
 {
 namespace vulkan
 {
+/// @brief Samplers with the same settings share the same VkSampler (see DeviceObjectCache)
 class Sampler
 {
 public:
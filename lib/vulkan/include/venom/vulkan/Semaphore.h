@@ -25,10 +25,23 @@ public:
 
     void DestroySemaphore();
     vc::Error InitSemaphore();
+    /// @brief Creates a Vulkan 1.2 timeline semaphore, its payload only ever increases
+    vc::Error InitTimelineSemaphore(const uint64_t initialValue = 0);
     VkSemaphore GetSemaphore() const;
+    bool IsTimeline() const;
+
+    // Timeline semaphores only
+    /// @brief Current payload, i.e. the last value signaled by the GPU (or the host)
+    uint64_t GetCounterValue() const;
+    /// @brief Blocks until the payload reaches value
+    /// @return vc::Error::Failure on timeout
+    vc::Error Wait(const uint64_t value, const uint64_t timeout = UINT64_MAX) const;
+    /// @brief Signals value from the host
+    vc::Error Signal(const uint64_t value) const;
 
 private:
     VkSemaphore __semaphore;
+    bool __isTimeline;
 };
 }
 }
\ No newline at end of file
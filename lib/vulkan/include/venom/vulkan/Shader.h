@@ -15,6 +15,9 @@
 
 #include <venom/common/math/Matrix.h>
 
+#include <atomic>
+#include <future>
+
 namespace venom
 {
 namespace vulkan
@@ -30,22 +33,58 @@ public:
     ShaderPipeline& operator=(ShaderPipeline&& other) noexcept;
 
     vc::Error AddVertexBufferToLayout(const uint32_t vertexSize, const uint32_t binding, const uint32_t location, const uint32_t offset, const VkFormat format);
+    /// @brief The uniform or storage buffer at set/binding is bound with a dynamic offset (e.g. into the UniformArena),
+    /// which SPIR-V can't express. To call before loading the shaders
+    void SetDynamicBuffer(const uint32_t set, const uint32_t binding);
     vc::Error LoadShaders(const SwapChain * swapChain, const RenderPass * renderPass, const std::vector<std::string>& shaderPaths);
+    /// @brief Creates the layouts right away (descriptor sets can be allocated) and compiles the pipeline on the global thread pool.
+    /// The vertex layout must not change until the pipeline is ready.
+    vc::Error LoadShadersAsync(const SwapChain * swapChain, const RenderPass * renderPass, const std::vector<std::string>& shaderPaths);
+    /// @brief True once the pipeline can be bound
+    bool IsReady() const;
+    /// @brief True while the pipeline is compiling, neither ready nor pending after a load means it failed
+    bool IsPending() const;
+    /// @brief Blocks until the compilation is done
+    /// @return its result
+    vc::Error WaitReady() const;
+    /// @brief VK_NULL_HANDLE until ready
     VkPipeline GetPipeline() const;
+    /// @brief Layouts are shared with every pipeline whose shaders have the same resources (see DeviceObjectCache)
     VkPipelineLayout GetPipelineLayout() const;
-    const VkDescriptorSetLayout & GetDescriptorSetLayout() const;
+    const VkDescriptorSetLayout & GetDescriptorSetLayout(const uint32_t set = 0) const;
+    const std::vector<VkDescriptorSetLayout> & GetDescriptorSetLayouts() const;
 
 private:
-    vc::Error LoadShader(const std::string& shaderPath, VkPipelineShaderStageCreateInfo * pipelineCreateInfo);
+    struct ShaderStage
+    {
+        std::string path;
+        VkShaderStageFlagBits stage;
+        std::vector<uint32_t> code;
+    };
+
+    vc::Error LoadShader(const std::string& shaderPath, ShaderStage * stage);
+    vc::Error __LoadStages(const std::vector<std::string> & shaderPaths, std::vector<ShaderStage> & stages);
+    /// @brief Reflects the stages' SPIR-V: stage types, descriptor set layouts, push constant ranges and,
+    /// if none was given with AddVertexBufferToLayout(), the vertex input layout
+    vc::Error __CreateLayouts(std::vector<ShaderStage> & stages);
+    void __ReleaseLayouts();
+    /// @brief Thread safe, only touches __graphicsPipeline and __ready
+    vc::Error __CreatePipeline(const VkRenderPass renderPass, const std::vector<ShaderStage> & stages);
 
 private:
     VkPipeline __graphicsPipeline;
+    // References to the DeviceObjectCache's layouts
     VkPipelineLayout __pipelineLayout;
-    DescriptorSetLayout __descriptorSetLayout;
+    std::vector<VkDescriptorSetLayout> __descriptorSetLayouts;
+    // (set, binding) of the dynamic buffers
+    std::vector<std::pair<uint32_t, uint32_t>> __dynamicBuffers;
     std::vector<std::unique_ptr<VertexBuffer>> __vertexBuffers;
 
     std::vector<VkVertexInputBindingDescription> __bindingDescriptions;
     std::vector<VkVertexInputAttributeDescription> __attributeDescriptions;
+
+    std::atomic<bool> __ready;
+    std::shared_future<vc::Error> __pipelineJob;
 };
 
 }
@@ -0,0 +1,79 @@
+///
+/// Project: VenomEngine
+/// @file StagingRingBuffer.h
+/// @date Oct, 16 2026
+/// @brief Persistently mapped ring buffer that upload staging data is linearly sub-allocated from.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+
+#include <deque>
+#include <memory>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Range of the staging ring, valid until released and its upload batch completes.
+struct StagingAllocation
+{
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void * mappedData = nullptr;
+    /// @brief Internal identifier used to release the range
+    uint64_t id = 0;
+};
+
+/// @brief Replaces one HOST_VISIBLE staging Buffer per upload.
+/// Ranges are handed out in order and reclaimed in order once the batch (fence) they were
+/// released with has signaled. If the ring is full, a bigger one replaces it and the old one
+/// is kept alive until its last range is reclaimed.
+/// Not thread-safe on its own, UploadManager serializes access to it.
+class StagingRingBuffer
+{
+public:
+    StagingRingBuffer();
+    ~StagingRingBuffer();
+    StagingRingBuffer(const StagingRingBuffer&) = delete;
+    StagingRingBuffer& operator=(const StagingRingBuffer&) = delete;
+
+    vc::Error Init(const VkDeviceSize size);
+    void Destroy();
+
+    vc::Error Allocate(const VkDeviceSize size, const VkDeviceSize alignment, StagingAllocation * allocation);
+    /// @brief Marks the range as reusable once the batch identified by completionHandle has completed
+    void Release(const StagingAllocation & allocation, const uint64_t completionHandle);
+    /// @brief Reclaims every released range whose batch is <= lastCompletedHandle
+    void Update(const uint64_t lastCompletedHandle);
+
+    VkDeviceSize GetCapacity() const;
+
+private:
+    struct Region
+    {
+        uint64_t id;
+        VkDeviceSize begin, end;
+        uint64_t completionHandle;
+        bool released;
+    };
+    struct Ring
+    {
+        Buffer buffer;
+        std::deque<Region> regions;
+    };
+
+    vc::Error __CreateRing(const VkDeviceSize size);
+    static bool __TryAllocate(Ring & ring, const VkDeviceSize size, const VkDeviceSize alignment, VkDeviceSize * offset);
+    static void __Reclaim(Ring & ring, const uint64_t lastCompletedHandle);
+
+private:
+    std::unique_ptr<Ring> __ring;
+    /// @brief Rings replaced after a grow, freed when empty
+    std::vector<std::unique_ptr<Ring>> __oldRings;
+    uint64_t __nextId;
+};
+}
+}
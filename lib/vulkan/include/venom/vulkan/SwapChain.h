@@ -11,6 +11,7 @@
 #include <venom/vulkan/Surface.h>
 #include <venom/vulkan/QueueFamily.h>
 #include <venom/vulkan/ImageView.h>
+#include <venom/vulkan/Image.h>
 #include <venom/vulkan/plugin/graphics/Texture.h>
 
 #include <venom/common/Context.h>
@@ -31,6 +32,7 @@ public:
     SwapChain(SwapChain&&);
     SwapChain& operator=(SwapChain&&);
 
+    /// @brief Retires the swap chain and its framebuffers & image views through the deletion queue
     void CleanSwapChain();
 
     vc::Error InitSwapChainSettings(const PhysicalDevice* physicalDevice, const Surface* surface,
@@ -44,8 +46,14 @@ public:
     /// @return Error
     vc::Error InitSwapChain(const Surface* surface, const vc::Context* context,
                             const MappedQueueFamilies* queueFamilies);
+    /// @brief Headless mode: creates imageCount offscreen color images (readable with transfers) in place of
+    /// a presentable swap chain, framebuffers are then created the same way
+    vc::Error InitOffscreen(const uint32_t width, const uint32_t height, const uint32_t imageCount);
     vc::Error InitSwapChainFramebuffers(const RenderPass* renderPass);
 
+    bool IsOffscreen() const;
+    const Image & GetOffscreenImage(const uint32_t index) const;
+
 public:
     VkSurfaceCapabilitiesKHR capabilities;
     std::vector<VkSurfaceFormatKHR> surfaceFormats;
@@ -58,8 +66,13 @@ public:
     VkSwapchainKHR swapChain;
     std::vector<VkImage> swapChainImageHandles;
 
+private:
+    void __RetireSwapChainResources();
+    void __SetExtent(const VkExtent2D & newExtent);
+
 private:
     std::vector<ImageView> __swapChainImageViews;
+    std::vector<Image> __offscreenImages;
     VulkanTexture * __depthTexture;
     std::vector<VkFramebuffer> __swapChainFramebuffers;
 
@@ -0,0 +1,65 @@
+///
+/// Project: VenomEngine
+/// @file UniformArena.h
+/// @date Oct, 16 2026
+/// @brief Per frame, persistently mapped arena of uniform & storage data bound with dynamic offsets.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+
+#include <atomic>
+
+namespace venom
+{
+namespace vulkan
+{
+/// @brief Sub-range of the arena, valid until the next BeginFrame() of the same frame index
+struct UniformAllocation
+{
+    /// @brief Host coherent, written directly
+    void * data;
+    /// @brief Dynamic offset to bind the range with, the descriptor points at the start of the buffer
+    uint32_t offset;
+};
+
+/// @brief One buffer split in one region per frame in flight, every descriptor points at its start:
+/// per object data (e.g. transforms) is bound with a dynamic offset instead of one buffer and descriptor set per object.
+/// Allocations are a single atomic bump, aligned to the device's min uniform & storage buffer offset alignments,
+/// and the region is recycled as a whole once the GPU is done with its frame.
+class UniformArena
+{
+public:
+    UniformArena();
+    ~UniformArena();
+    UniformArena(const UniformArena&) = delete;
+    UniformArena& operator=(const UniformArena&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    UniformArena(UniformArena&&) = delete;
+    UniformArena& operator=(UniformArena&&) = delete;
+
+    /// @param frameSize bytes per frame, rounded up to the alignment
+    vc::Error Init(const VkDeviceSize frameSize, const uint32_t frameCount);
+    void Destroy();
+
+    /// @brief Recycles the region of the frame, to call once the GPU is done with it (after its fence was waited on)
+    static void BeginFrame(const uint32_t frameIndex);
+    /// @brief Thread safe and lock free
+    /// @return data is nullptr if the frame's region is full
+    static UniformAllocation Allocate(const VkDeviceSize size);
+    /// @brief Buffer every descriptor of the arena points at
+    static VkBuffer GetVkBuffer();
+    static VkDeviceSize GetAlignment();
+
+private:
+    Buffer __buffer;
+    uint8_t * __mappedData;
+    VkDeviceSize __frameSize;
+    VkDeviceSize __alignment;
+    uint32_t __frameIndex;
+    /// @brief Bytes used in the current frame's region
+    std::atomic<VkDeviceSize> __head;
+};
+}
+}
@@ -0,0 +1,111 @@
+///
+/// Project: VenomEngine
+/// @file UploadManager.h
+/// @date Oct, 16 2026
+/// @brief Batches staging -> device copies into few submissions tracked by a timeline semaphore.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+#include <venom/vulkan/Semaphore.h>
+#include <venom/vulkan/StagingRingBuffer.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+class CommandBuffer;
+class Image;
+
+/// @brief Identifies the batch an upload was recorded in, 0 means nothing pending.
+typedef uint64_t UploadHandle;
+
+/// @brief Records buffer & image copies into one transfer command buffer per batch and submits it
+/// once per frame (or earlier if the batch grows past a size threshold).
+/// Each batch signals its handle on one timeline semaphore, the queue is never idled.
+/// Staging data lives in a persistent StagingRingBuffer recycled as batches complete.
+class UploadManager
+{
+public:
+    UploadManager();
+    ~UploadManager();
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    UploadManager(UploadManager&&) = delete;
+    UploadManager& operator=(UploadManager&&) = delete;
+
+    /// @param stagingSize initial size of the staging ring, taken from vc::Config
+    vc::Error Init(const VkDeviceSize stagingSize, const VkDeviceSize flushThreshold = DEFAULT_FLUSH_THRESHOLD);
+    void Destroy();
+
+    /// @brief Copies data to the staging ring and records its copy to dstBuffer
+    /// @param handle set to the handle of the batch containing the copy, to Wait() on or poll with IsComplete()
+    static vc::Error UploadBuffer(const void * data, const VkDeviceSize size, const Buffer & dstBuffer, UploadHandle * handle, const VkDeviceSize dstOffset = 0);
+    /// @brief Copies data to the staging ring and records its copy to the whole image, between the layout transitions
+    /// UNDEFINED -> TRANSFER_DST -> SHADER_READ_ONLY. Frames sample it safely once they wait on its batch (see GetSubmittedHandle())
+    static vc::Error UploadImage(const void * data, const VkDeviceSize size, Image & image, const VkFormat format, UploadHandle * handle);
+    /// @brief Submits the batch currently being recorded, if any
+    static vc::Error Flush();
+    /// @brief Polls in flight batches and recycles the completed ones, to call once per frame
+    static void Update();
+    /// @brief Lock free, as of the last Update()
+    static bool IsComplete(const UploadHandle handle);
+    /// @brief Lock free, true once the batch is submitted: a submission waiting on GetSubmittedHandle() may use its copies
+    static bool IsSubmitted(const UploadHandle handle);
+    /// @brief Handle of the last batch known to be complete, as of the last Update()
+    static UploadHandle GetCompletedHandle();
+    /// @brief Handle of the last submitted batch, for frames to wait on through GetTimelineSemaphore()
+    static UploadHandle GetSubmittedHandle();
+    /// @brief Reaches each batch's handle once its copies are done
+    static VkSemaphore GetTimelineSemaphore();
+    /// @brief Handle of the most recent batch, recording or submitted (0 if none)
+    static UploadHandle GetLatestHandle();
+    /// @brief Blocks until the batch is complete, flushes it first if needed
+    static vc::Error Wait(const UploadHandle handle);
+    static void WaitAll();
+
+public:
+    static constexpr VkDeviceSize DEFAULT_FLUSH_THRESHOLD = 32ull * 1024ull * 1024ull;
+    /// @brief Satisfies vkCmdCopyBufferToImage (multiple of 4 and of the texel size) for every format we use
+    static constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+
+private:
+    struct Batch
+    {
+        CommandBuffer * commandBuffer = nullptr;
+        VkDeviceSize recordedBytes = 0;
+        UploadHandle handle = 0;
+    };
+
+    vc::Error __BeginBatch();
+    /// @brief Starts a batch if needed and copies data to staging memory
+    vc::Error __Stage(const void * data, const VkDeviceSize size, StagingAllocation * staging);
+    /// @brief Ties staging to the recording batch once its copy is recorded, flushes the batch if it grew big enough
+    vc::Error __EndCopy(const StagingAllocation & staging, const VkDeviceSize size, UploadHandle * handle);
+    vc::Error __Flush();
+    void __Update();
+
+private:
+    StagingRingBuffer __stagingRing;
+    // Payload is the handle of the last completed batch
+    Semaphore __timeline;
+    std::unique_ptr<Batch> __recordingBatch;
+    std::deque<std::unique_ptr<Batch>> __inFlightBatches;
+    std::vector<std::unique_ptr<Batch>> __freeBatches;
+    // Read without the lock: handles destroyed while the lock is held (staging rings) query it
+    std::atomic<UploadHandle> __nextHandle;
+    // Written under the lock, read without it by the draw path
+    std::atomic<UploadHandle> __lastSubmittedHandle;
+    std::atomic<UploadHandle> __lastCompletedHandle;
+    VkDeviceSize __flushThreshold;
+    std::mutex __mutex;
+};
+}
+}
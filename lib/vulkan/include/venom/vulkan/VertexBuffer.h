@@ -9,6 +9,7 @@
 
 #include <venom/vulkan/Debug.h>
 #include <venom/vulkan/Buffer.h>
+#include <venom/vulkan/UploadManager.h>
 
 namespace venom
 {
@@ -24,9 +25,11 @@ public:
     VertexBuffer(VertexBuffer&&);
     VertexBuffer& operator=(VertexBuffer&&);
 
+    /// @brief Creates the device local buffer and queues the upload of data, returns before the copy is done
     vc::Error Init(const uint32_t vertexCount, const uint32_t vertexSize, const VkBufferUsageFlags flags, const void *data);
     VkBuffer GetVkBuffer() const;
-    static vc::Error CopyBuffer(const Buffer& srcBuffer, const Buffer& dstBuffer, const VkDeviceSize size);
+    UploadHandle GetUploadHandle() const;
+    bool IsUploaded() const;
     uint32_t GetVertexCount() const;
     uint32_t GetVertexSize() const;
     uint32_t GetTotalSize() const;
@@ -35,6 +38,7 @@ private:
     Buffer __buffer;
     uint32_t __vertexCount;
     uint32_t __vertexSize;
+    UploadHandle __uploadHandle;
 };
 typedef VertexBuffer IndexBuffer;
 }
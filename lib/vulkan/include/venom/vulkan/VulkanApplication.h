@@ -18,17 +18,32 @@
 #include <venom/vulkan/Semaphore.h>
 #include <venom/vulkan/Fence.h>
 #include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/DeviceMemoryAllocator.h>
+#include <venom/vulkan/PipelineCache.h>
+#include <venom/vulkan/DeviceObjectCache.h>
+#include <venom/vulkan/BindlessTextureTable.h>
 #include <venom/vulkan/plugin/graphics/Model.h>
 #include <venom/vulkan/CommandPoolManager.h>
 #include <venom/vulkan/QueueManager.h>
+#include <venom/vulkan/UploadManager.h>
+#include <venom/vulkan/FrameSync.h>
+#include <venom/vulkan/GpuProfiler.h>
+#include <venom/vulkan/DeletionQueue.h>
+#include <venom/vulkan/ReadbackManager.h>
 #include <venom/vulkan/UniformBuffer.h>
 #include <venom/vulkan/DescriptorPool.h>
+#include <venom/vulkan/DescriptorAllocator.h>
+#include <venom/vulkan/DescriptorUpdateTemplate.h>
+#include <venom/vulkan/UniformArena.h>
 
 #include <venom/common/plugin/graphics/GraphicsApplication.h>
 #include <venom/common/Context.h>
+#include <venom/common/Timer.h>
 
 #include "venom/common/math/Vector.h"
 
+#include <unordered_map>
+
 namespace venom
 {
 /// @brief Encapsulation of Vulkan for the front end of VenomEngine.
@@ -49,6 +64,9 @@ private:
     vc::Error __Loop();
     void __UpdateUniformBuffers();
     vc::Error __DrawFrame();
+    vc::Error __RecordDraws(CommandBuffer * commandBuffer, uint32_t imageIndex);
+    void __BindDrawState(CommandBuffer * commandBuffer);
+    void __RecordDrawRange(CommandBuffer * commandBuffer, const size_t begin, const size_t end);
     vc::Error __InitVulkan();
 
     void __SetGLFWCallbacks();
@@ -58,11 +76,19 @@ private:
 
     vc::Error __CreateInstance();
 
-    void __RecreateSwapChain();
+    vc::Error __RecreateSwapChain();
 
 private:
     Instance __instance;
     LogicalDevice __logicalDevice;
+    // Must be destroyed after every resource but before the logical device
+    DeviceMemoryAllocator __deviceMemoryAllocator;
+    // Saved to disk on destruction, after every pipeline using it
+    PipelineCache __pipelineCache;
+    // Samplers & layouts, outlive every owner
+    DeviceObjectCache __deviceObjectCache;
+    // Only initialized if the device supports descriptor indexing
+    BindlessTextureTable __bindlessTextureTable;
     std::vector<const char *> __instanceExtensions;
     vc::Context __context;
     PhysicalDevice __physicalDevice;
@@ -71,7 +97,16 @@ private:
     SwapChain __swapChain;
     RenderPass __renderPass;
     CommandPoolManager __commandPoolManager;
+    DescriptorAllocator __descriptorAllocator;
+    UniformArena __uniformArena;
     QueueManager __queueManager;
+    UploadManager __uploadManager;
+    FrameSync __frameSync;
+    GpuProfiler __gpuProfiler;
+    // Destroyed before the systems it queries, flushes what's left on destruction
+    DeletionQueue __deletionQueue;
+    // Headless only, destroyed first: waits for the pending readbacks
+    ReadbackManager __readbackManager;
 
     Queue __graphicsQueue, __presentQueue;
 
@@ -85,12 +120,34 @@ private:
     Sampler __sampler;
     ShaderPipeline __shaderPipeline;
     static constexpr const int MAX_FRAMES_IN_FLIGHT = 3;
-    std::vector<CommandBuffer *> __commandBuffers;
-    std::vector<Semaphore> __imageAvailableSemaphores;
-    std::vector<Semaphore> __renderFinishedSemaphores;
-    std::vector<Fence> __inFlightFences;
+    /// @brief Below twice this amount of draws, everything is recorded inline on the main thread
+    static constexpr const size_t MIN_DRAWS_PER_RECORDING_JOB = 128;
+    /// @brief Per object uniforms a frame can hold, 16384 transforms with a 256 bytes alignment
+    static constexpr const VkDeviceSize UNIFORM_ARENA_FRAME_SIZE = 4 * 1024 * 1024;
+    std::vector<VulkanMesh *> __drawList;
+    /// @brief LOD of each draw, selected before recording
+    std::vector<uint32_t> __drawLods;
+    /// @brief Camera the LODs are selected for
+    vc::LodView __lodView;
+    /// @brief Bindless index of each draw's texture, pushed per draw
+    std::vector<uint32_t> __drawTextureIndices;
+    /// @brief Dynamic offset of each draw's object data in the uniform arena
+    std::vector<uint32_t> __drawObjectOffsets;
+    /// @brief Model matrix, the same for every draw until objects have their own transform
+    vcm::Mat4 __objectTransform;
+    /// @brief Without bindless: set 0 of each draw, one transient set per texture of the frame
+    std::vector<VkDescriptorSet> __drawDescriptorSets;
+    std::unordered_map<const VulkanTexture *, VkDescriptorSet> __textureDescriptorSets;
+    /// @brief Writes a whole set 0 of a draw at once
+    DescriptorUpdateTemplate __drawSetTemplate;
+    std::vector<CommandBuffer *> __secondaryCommandBuffers;
     int __currentFrame;
+    /// @brief Frames drawn so far, to stop after vc::Config's max frame count
+    uint64_t __frameCount;
     bool __framebufferChanged;
+    /// @brief Time since the last framebuffer resize event, for debouncing
+    vc::Timer __resizeTimer;
+    static constexpr const uint64_t SWAP_CHAIN_RESIZE_DEBOUNCE_MS = 50;
     VulkanModel * __model;
     VulkanMesh * __mesh;
     UniformBuffer __uniformBuffers[MAX_FRAMES_IN_FLIGHT];
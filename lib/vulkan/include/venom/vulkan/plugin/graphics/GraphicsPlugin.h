@@ -22,6 +22,9 @@ public:
     vc::Mesh * CreateMesh() override;
     vc::Texture * CreateTexture() override;
     vc::Material* CreateMaterial() override;
+
+protected:
+    void CleanPluginObjects() override;
 };
 }
 }
@@ -22,7 +22,8 @@ public:
     VulkanMesh();
     ~VulkanMesh();
     void Draw() override;
-    vc::Error __LoadMeshFromCurrentData() override;
+    /// @brief Creates GPU buffers and queues their upload, returns without waiting for the copies
+    vc::Error __LoadMeshFromStreams(const vc::MeshStreams & streams) override;
 
     vc::Error AddVertexBuffer(const void* data, const uint32_t vertexCount, const uint32_t vertexSize, int binding);
     vc::Error AddIndexBuffer(const void* data, const uint32_t indexCount, const uint32_t indexSize);
@@ -31,6 +32,10 @@ public:
     uint32_t GetBindingCount() const;
     uint32_t GetVertexCount() const;
     VkDeviceSize * GetOffsets() const;
+    /// @brief Handle of the last upload batch the mesh buffers were recorded in
+    UploadHandle GetUploadHandle() const;
+    /// @brief True once every vertex/index buffer upload is submitted, the frame drawing it waits for the copies on the GPU
+    bool IsReady() const;
 
     struct BoundVkBuffer
     {
@@ -44,6 +49,7 @@ private:
     std::vector<BoundVkBuffer> __vkVertexBuffers;
     std::vector<VkDeviceSize> __offsets;
     IndexBuffer __indexBuffer;
+    UploadHandle __uploadHandle;
 };
 }
 }
@@ -25,14 +25,17 @@ public:
     VulkanTexture();
     ~VulkanTexture();
 
-    vc::Error __LoadImage(unsigned char * pixels, int width, int height, int channels) override;
+    vc::Error __LoadImage(const unsigned char * pixels, int width, int height, int channels) override;
     vc::Error __InitDepthBuffer(int width, int height) override;
 
     const Image & GetImage() const;
     const ImageView & GetImageView() const;
+    /// @brief Index in the BindlessTextureTable, INVALID_INDEX if bindless textures are disabled
+    uint32_t GetBindlessIndex() const;
 private:
     Image __image;
     ImageView __imageView;
+    uint32_t __bindlessIndex;
 };
 
 }
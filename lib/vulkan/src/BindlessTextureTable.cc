@@ -0,0 +1,186 @@
+///
+/// Project: VenomEngine
+/// @file BindlessTextureTable.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/BindlessTextureTable.h>
+#include <venom/vulkan/DeviceObjectCache.h>
+#include <venom/vulkan/DescriptorWriter.h>
+#include <venom/vulkan/PhysicalDevice.h>
+
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+
+namespace venom
+{
+namespace vulkan
+{
+static BindlessTextureTable * s_bindlessTextureTable = nullptr;
+
+BindlessTextureTable::BindlessTextureTable()
+    : __layout(VK_NULL_HANDLE)
+    , __set(VK_NULL_HANDLE)
+    , __capacity(0)
+    , __slotCount(0)
+{
+    s_bindlessTextureTable = this;
+}
+
+BindlessTextureTable::~BindlessTextureTable()
+{
+    Destroy();
+    s_bindlessTextureTable = nullptr;
+}
+
+vc::Error BindlessTextureTable::Init()
+{
+    VENOM_TRACE_FUNCTION();
+    VkPhysicalDeviceVulkan12Properties vulkan12Properties{};
+    vulkan12Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+    VkPhysicalDeviceProperties2 properties2{};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &vulkan12Properties;
+    vkGetPhysicalDeviceProperties2(PhysicalDevice::GetUsedVkPhysicalDevice(), &properties2);
+    __capacity = std::min({MAX_TEXTURE_COUNT,
+        vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages});
+
+    __layout = __AcquireLayout();
+    if (__layout == VK_NULL_HANDLE)
+        return vc::Error::InitializationFailed;
+
+    __pool.AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, __capacity);
+    if (__pool.Create(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT, 1) != vc::Error::Success)
+        return vc::Error::InitializationFailed;
+    const std::vector<DescriptorSet> sets = __pool.AllocateSets(__layout, 1);
+    if (sets.empty() || sets[0].GetVkDescriptorSet() == VK_NULL_HANDLE)
+        return vc::Error::InitializationFailed;
+    __set = sets[0].GetVkDescriptorSet();
+    vc::Log::Print("Bindless textures enabled: %u slots", __capacity);
+    return vc::Error::Success;
+}
+
+void BindlessTextureTable::Destroy()
+{
+    // The set is freed with the pool
+    __set = VK_NULL_HANDLE;
+    DeviceObjectCache::Release(__layout);
+    __layout = VK_NULL_HANDLE;
+    std::lock_guard<std::mutex> lock(__mutex);
+    __slotCount = 0;
+    __freeSlots.clear();
+    __retiredSlots.clear();
+    __pendingWrites.clear();
+}
+
+bool BindlessTextureTable::IsSupported(const VkPhysicalDeviceFeatures& supported, const VkPhysicalDeviceVulkan12Features& supported12,
+    VkPhysicalDeviceFeatures* enabled, VkPhysicalDeviceVulkan12Features* enabled12)
+{
+    // Indices are uniform per draw: dynamic indexing is enough, non uniform indexing isn't needed
+    if (supported.shaderSampledImageArrayDynamicIndexing != VK_TRUE
+        || supported12.runtimeDescriptorArray != VK_TRUE
+        || supported12.descriptorBindingPartiallyBound != VK_TRUE
+        || supported12.descriptorBindingSampledImageUpdateAfterBind != VK_TRUE)
+        return false;
+    enabled->shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+    enabled12->runtimeDescriptorArray = VK_TRUE;
+    enabled12->descriptorBindingPartiallyBound = VK_TRUE;
+    enabled12->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    return true;
+}
+
+bool BindlessTextureTable::IsEnabled()
+{
+    return s_bindlessTextureTable && s_bindlessTextureTable->__set != VK_NULL_HANDLE;
+}
+
+uint32_t BindlessTextureTable::Register(VkImageView imageView)
+{
+    if (!IsEnabled() || imageView == VK_NULL_HANDLE)
+        return INVALID_INDEX;
+    BindlessTextureTable * table = s_bindlessTextureTable;
+    std::lock_guard<std::mutex> lock(table->__mutex);
+    while (!table->__retiredSlots.empty() && FrameSync::IsFrameComplete(table->__retiredSlots.front().frame)) {
+        table->__freeSlots.emplace_back(table->__retiredSlots.front().index);
+        table->__retiredSlots.pop_front();
+    }
+
+    uint32_t index;
+    if (!table->__freeSlots.empty()) {
+        index = table->__freeSlots.back();
+        table->__freeSlots.pop_back();
+    } else if (table->__slotCount < table->__capacity) {
+        index = table->__slotCount++;
+    } else {
+        vc::Log::Error("Bindless texture table full (%u textures)", table->__capacity);
+        return INVALID_INDEX;
+    }
+    table->__pendingWrites.emplace_back(index, imageView);
+    return index;
+}
+
+void BindlessTextureTable::Unregister(const uint32_t index)
+{
+    if (!IsEnabled() || index == INVALID_INDEX)
+        return;
+    BindlessTextureTable * table = s_bindlessTextureTable;
+    std::lock_guard<std::mutex> lock(table->__mutex);
+    // Never written, the view may be gone by the next Update()
+    std::erase_if(table->__pendingWrites, [index](const std::pair<uint32_t, VkImageView> & write) {
+        return write.first == index;
+    });
+    // The slot is left as is: partially bound, it's never read again
+    table->__retiredSlots.push_back({index, FrameSync::GetCurrentFrameValue()});
+}
+
+void BindlessTextureTable::Update()
+{
+    if (!IsEnabled())
+        return;
+    BindlessTextureTable * table = s_bindlessTextureTable;
+    std::lock_guard<std::mutex> lock(table->__mutex);
+    if (table->__pendingWrites.empty())
+        return;
+
+    DescriptorWriter writer;
+    for (const auto & [index, imageView] : table->__pendingWrites)
+        writer.WriteImage(table->__set, 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, index);
+    writer.Flush();
+    table->__pendingWrites.clear();
+}
+
+VkDescriptorSet BindlessTextureTable::GetVkDescriptorSet()
+{
+    return s_bindlessTextureTable ? s_bindlessTextureTable->__set : VK_NULL_HANDLE;
+}
+
+VkDescriptorSetLayout BindlessTextureTable::AcquireDescriptorSetLayout()
+{
+    if (!IsEnabled())
+        return VK_NULL_HANDLE;
+    return s_bindlessTextureTable->__AcquireLayout();
+}
+
+uint32_t BindlessTextureTable::GetCapacity()
+{
+    return s_bindlessTextureTable ? s_bindlessTextureTable->__capacity : 0;
+}
+
+VkDescriptorSetLayout BindlessTextureTable::__AcquireLayout() const
+{
+    // Same description every time: the cache hands out the same layout to the table and to every shader
+    const VkDescriptorSetLayoutBinding binding {
+        .binding = 0,
+        .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+        .descriptorCount = __capacity,
+        .stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS,
+        .pImmutableSamplers = nullptr
+    };
+    return DeviceObjectCache::AcquireDescriptorSetLayout({binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+        {VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT});
+}
+}
+}
@@ -8,6 +8,7 @@
 #include <venom/vulkan/Buffer.h>
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DeletionQueue.h>
 
 namespace venom
 {
@@ -15,51 +16,42 @@ namespace vulkan
 {
 Buffer::Buffer()
     : __buffer(VK_NULL_HANDLE)
-    , __memory(VK_NULL_HANDLE)
+    , __allocation()
     , __bufferCreateInfo{}
 {
 }
 
 Buffer::~Buffer()
 {
-    if (__buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(LogicalDevice::GetVkDevice(), __buffer, Allocator::GetVKAllocationCallbacks());
-    if (__memory != VK_NULL_HANDLE)
-        vkFreeMemory(LogicalDevice::GetVkDevice(), __memory, Allocator::GetVKAllocationCallbacks());
+    // Frames in flight may still read it
+    if (__buffer != VK_NULL_HANDLE || __allocation.IsValid())
+        DeletionQueue::DestroyBuffer(__buffer, &__allocation);
 }
 
 Buffer::Buffer(Buffer&& other)
     : __buffer(other.__buffer)
-    , __memory(other.__memory)
+    , __allocation(other.__allocation)
     , __bufferCreateInfo(other.__bufferCreateInfo)
 {
     other.__buffer = VK_NULL_HANDLE;
-    other.__memory = VK_NULL_HANDLE;
+    other.__allocation = DeviceMemoryAllocation{};
 }
 
 Buffer& Buffer::operator=(Buffer&& other)
 {
     if (this != &other) {
         __buffer = other.__buffer;
-        __memory = other.__memory;
+        __allocation = other.__allocation;
         __bufferCreateInfo = other.__bufferCreateInfo;
         other.__buffer = VK_NULL_HANDLE;
-        other.__memory = VK_NULL_HANDLE;
+        other.__allocation = DeviceMemoryAllocation{};
     }
     return *this;
 }
 
 uint32_t Buffer::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
 {
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(PhysicalDevice::GetUsedVkPhysicalDevice(), &memProperties);
-
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i) {
-        if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
-    }
-    return -1;
+    return DeviceMemoryAllocator::FindMemoryType(typeFilter, properties);
 };
 
 vc::Error Buffer::CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags flags, const VkSharingMode sharingMode,
@@ -78,17 +70,9 @@ vc::Error Buffer::CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags
         return vc::Error::Failure;
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(LogicalDevice::GetVkDevice(), __buffer, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, memoryProperties);
-
-    if (vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &__memory) != VK_SUCCESS) {
+    if (auto err = DeviceMemoryAllocator::AllocateForBuffer(__buffer, memoryProperties, &__allocation); err != vc::Error::Success) {
         vc::Log::Error("Failed to allocate vertex buffer memory");
-        return vc::Error::Failure;
+        return err;
     }
 
     if (auto err = __BindBufferMemory(); err != vc::Error::Success) {
@@ -100,8 +84,8 @@ vc::Error Buffer::CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags
 
 vc::Error Buffer::__BindBufferMemory()
 {
-    venom_assert(__buffer != VK_NULL_HANDLE && __memory != VK_NULL_HANDLE, "Buffer not created");
-    if (vkBindBufferMemory(LogicalDevice::GetVkDevice(), __buffer, __memory, 0) != VK_SUCCESS) {
+    venom_assert(__buffer != VK_NULL_HANDLE && __allocation.IsValid(), "Buffer not created");
+    if (vkBindBufferMemory(LogicalDevice::GetVkDevice(), __buffer, __allocation.memory, __allocation.offset) != VK_SUCCESS) {
         vc::Log::Error("Failed to bind buffer memory");
         return vc::Error::Failure;
     }
@@ -110,13 +94,18 @@ vc::Error Buffer::__BindBufferMemory()
 
 vc::Error Buffer::WriteBuffer(const void* data)
 {
-    void* dataMap;
-    if (auto vkErr = vkMapMemory(LogicalDevice::GetVkDevice(), __memory, 0, __bufferCreateInfo.size, 0, &dataMap); vkErr != VK_SUCCESS) {
-        vc::Log::Error("Failed to map buffer memory");
+    return WriteBuffer(data, __bufferCreateInfo.size, 0);
+}
+
+vc::Error Buffer::WriteBuffer(const void* data, const VkDeviceSize size, const VkDeviceSize offset)
+{
+    // Host visible memory is persistently mapped by the DeviceMemoryAllocator
+    if (__allocation.mappedData == nullptr) {
+        vc::Log::Error("Failed to write buffer: memory is not host visible");
         return vc::Error::Failure;
     }
-    memcpy(dataMap, data, __bufferCreateInfo.size);
-    vkUnmapMemory(LogicalDevice::GetVkDevice(), __memory);
+    venom_assert(offset + size <= __bufferCreateInfo.size, "Buffer::WriteBuffer() : out of range");
+    memcpy(static_cast<char *>(__allocation.mappedData) + offset, data, size);
     return vc::Error::Success;
 }
 
@@ -127,7 +116,17 @@ VkBuffer Buffer::GetVkBuffer() const
 
 const VkDeviceMemory & Buffer::GetVkDeviceMemory() const
 {
-    return __memory;
+    return __allocation.memory;
+}
+
+VkDeviceSize Buffer::GetMemoryOffset() const
+{
+    return __allocation.offset;
+}
+
+void* Buffer::GetMappedData() const
+{
+    return __allocation.mappedData;
 }
 
 VkDeviceSize Buffer::GetSize() const
@@ -11,12 +11,16 @@
 #include <venom/vulkan/QueueManager.h>
 #include <venom/vulkan/Shader.h>
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace venom::vulkan
 {
 CommandBuffer::CommandBuffer()
     : _commandBuffer(VK_NULL_HANDLE)
     , _queue(nullptr)
     , _isActive(false)
+    , _renderPassScope(INVALID_GPU_SCOPE)
 {
 }
 
@@ -66,6 +70,23 @@ vc::Error CommandBuffer::BeginCommandBuffer(VkCommandBufferUsageFlags flags)
     return vc::Error::Success;
 }
 
+vc::Error CommandBuffer::BeginSecondaryCommandBuffer(const VkCommandBufferInheritanceInfo& inheritanceInfo, VkCommandBufferUsageFlags flags)
+{
+    venom_assert(_isActive == false, "BeginSecondaryCommandBuffer() called while already begun");
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = flags | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    if (vkBeginCommandBuffer(_commandBuffer, &beginInfo) != VK_SUCCESS) {
+        vc::Log::Error("Failed to begin recording secondary command buffer");
+        return vc::Error::Failure;
+    }
+    _isActive = true;
+    return vc::Error::Success;
+}
+
 vc::Error CommandBuffer::EndCommandBuffer()
 {
     venom_assert(_isActive == true, "EndCommandBuffer() called before BeginCommandBuffer()");
@@ -78,6 +99,15 @@ vc::Error CommandBuffer::EndCommandBuffer()
     return vc::Error::Success;
 }
 
+void CommandBuffer::ExecuteCommands(const std::vector<CommandBuffer*>& secondaryCommandBuffers) const
+{
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    std::vector<VkCommandBuffer> vkCommandBuffers(secondaryCommandBuffers.size());
+    for (size_t i = 0; i < secondaryCommandBuffers.size(); ++i)
+        vkCommandBuffers[i] = secondaryCommandBuffers[i]->_commandBuffer;
+    vkCmdExecuteCommands(_commandBuffer, static_cast<uint32_t>(vkCommandBuffers.size()), vkCommandBuffers.data());
+}
+
 void CommandBuffer::Reset(VkCommandBufferResetFlags flags)
 {
     vkResetCommandBuffer(_commandBuffer, flags);
@@ -108,9 +138,12 @@ void CommandBuffer::Draw(uint32_t vertexCount, uint32_t instanceCount,
     vkCmdDraw(_commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
 
-void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh) const
+void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh, const uint32_t lod) const
 {
     venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    // Buffers' copies aren't submitted yet, skip the mesh for this frame
+    if (!vulkanMesh->IsReady())
+        return;
     const IndexBuffer & indexBuffer = vulkanMesh->GetIndexBuffer();
     const auto vertexBuffers = vulkanMesh->GetVkVertexBuffers();
     const VkDeviceSize * offsets = vulkanMesh->GetOffsets();
@@ -118,19 +151,34 @@ void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh) const
         vkCmdBindVertexBuffers(_commandBuffer, vertexBuffer.binding, 1, &vertexBuffer.buffer, offsets);
     }
     if (indexBuffer.GetVkBuffer() != VK_NULL_HANDLE) {
+        // Every LOD is a range of the same index buffer over the same vertices
+        const vc::MeshLod & range = vulkanMesh->GetLod(std::min(lod, vulkanMesh->GetLodCount() - 1));
         vkCmdBindIndexBuffer(_commandBuffer, indexBuffer.GetVkBuffer(), 0, VK_INDEX_TYPE_UINT32);
-        vkCmdDrawIndexed(_commandBuffer, indexBuffer.GetVertexCount(), 1, 0, 0, 0);
+        vkCmdDrawIndexed(_commandBuffer, range.indexCount, 1, range.firstIndex, 0, 0);
     } else {
         vkCmdDraw(_commandBuffer, vulkanMesh->GetVertexCount(), 1, 0, 0);
     }
 }
 
-void CommandBuffer::DrawModel(const VulkanModel * vulkanModel) const
+void CommandBuffer::DrawModel(const VulkanModel * vulkanModel, const vcm::Mat4 & transform, const vc::LodView & view) const
 {
     venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
-    for (const vc::Mesh * mesh : vulkanModel->GetMeshes()) {
-        DrawMesh(mesh->As<VulkanMesh>());
+    const GpuScopeId scope = GpuProfiler::BeginScope(this, "DrawModel");
+    for (vc::Mesh * mesh : vulkanModel->GetMeshes()) {
+        const uint32_t lod = mesh->SelectLod(mesh->GetScreenSize(transform, view));
+        DrawMesh(mesh->As<VulkanMesh>(), lod);
     }
+    GpuProfiler::EndScope(this, scope);
+}
+
+GpuScopeId CommandBuffer::BeginGpuScope(const char* name) const
+{
+    return GpuProfiler::BeginScope(this, name);
+}
+
+void CommandBuffer::EndGpuScope(const GpuScopeId scope) const
+{
+    GpuProfiler::EndScope(this, scope);
 }
 
 void CommandBuffer::PushConstants(const ShaderPipeline * shaderPipeline, VkShaderStageFlags stageFlags, uint32_t offset,
@@ -150,9 +198,14 @@ void CommandBuffer::CopyBuffer(const Buffer& srcBuffer, const Buffer& dstBuffer)
 }
 
 void CommandBuffer::CopyBufferToImage(const Buffer& srcBuffer, const Image& dstImage)
+{
+    CopyBufferToImage(srcBuffer.GetVkBuffer(), 0, dstImage);
+}
+
+void CommandBuffer::CopyBufferToImage(const VkBuffer srcBuffer, const VkDeviceSize srcOffset, const Image& dstImage)
 {
     VkBufferImageCopy region {
-        .bufferOffset = 0,
+        .bufferOffset = srcOffset,
         .bufferRowLength = 0,
         .bufferImageHeight = 0,
         .imageSubresource = {
@@ -168,7 +221,29 @@ void CommandBuffer::CopyBufferToImage(const Buffer& srcBuffer, const Image& dstI
             .depth = 1
         }
     };
-    vkCmdCopyBufferToImage(_commandBuffer, srcBuffer.GetVkBuffer(), dstImage.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vkCmdCopyBufferToImage(_commandBuffer, srcBuffer, dstImage.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
+
+void CommandBuffer::CopyImageToBuffer(const Image& srcImage, const Buffer& dstBuffer)
+{
+    VkBufferImageCopy region {
+        .bufferOffset = 0,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource = {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        },
+        .imageOffset = {0, 0, 0},
+        .imageExtent = {
+            .width = srcImage.GetWidth(),
+            .height = srcImage.GetHeight(),
+            .depth = 1
+        }
+    };
+    vkCmdCopyImageToBuffer(_commandBuffer, srcImage.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstBuffer.GetVkBuffer(), 1, &region);
 }
 
 void CommandBuffer::TransitionImageLayout(Image& image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout)
@@ -227,10 +302,35 @@ void CommandBuffer::TransitionImageLayout(Image& image, VkFormat format, VkImage
     image.__layout = newLayout;
 }
 
+void CommandBuffer::TransitionUploadedImage(Image& image)
+{
+    VkImageMemoryBarrier barrier {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = 0,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image.GetVkImage(),
+        .subresourceRange = {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        },
+    };
+    vkCmdPipelineBarrier(_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    image.__layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+}
+
 void CommandBuffer::BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
-                                       uint32_t firstSet, uint32_t descriptSetCount, VkDescriptorSet vkDescriptors)
+                                       uint32_t firstSet, uint32_t descriptSetCount, VkDescriptorSet vkDescriptors,
+                                       uint32_t dynamicOffsetCount, const uint32_t * dynamicOffsets)
 {
-    vkCmdBindDescriptorSets(_commandBuffer, vkPipelineBindPoint, vkPipelineLayout, firstSet, descriptSetCount, &vkDescriptors, 0, nullptr);
+    vkCmdBindDescriptorSets(_commandBuffer, vkPipelineBindPoint, vkPipelineLayout, firstSet, descriptSetCount, &vkDescriptors, dynamicOffsetCount, dynamicOffsets);
 }
 
 void CommandBuffer::SubmitToQueue(VkFence fence, VkSemaphore waitSemaphore, VkPipelineStageFlags waitStage,
@@ -250,6 +350,35 @@ void CommandBuffer::SubmitToQueue(VkFence fence, VkSemaphore waitSemaphore, VkPi
     vkQueueSubmit(_queue->GetVkQueue(), 1, &submitInfo, fence);
 }
 
+vc::Error CommandBuffer::SubmitToQueue(const Semaphore& timelineSemaphore, const uint64_t signalValue)
+{
+    const VkSemaphore signalSemaphore = timelineSemaphore.GetSemaphore();
+    VkTimelineSemaphoreSubmitInfo timelineInfo {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &signalValue
+    };
+    VkSubmitInfo submitInfo {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineInfo,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .pWaitDstStageMask = nullptr,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &_commandBuffer,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &signalSemaphore
+    };
+    if (VkResult res = vkQueueSubmit(_queue->GetVkQueue(), 1, &submitInfo, VK_NULL_HANDLE); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to submit command buffer signaling %" PRIu64 ": %d", signalValue, res);
+        return res == VK_ERROR_DEVICE_LOST ? vc::Error::DeviceLost : vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
 void CommandBuffer::WaitForQueue() const
 {
     vkQueueWaitIdle(_queue->GetVkQueue());
@@ -291,6 +420,8 @@ SingleTimeCommandBuffer& SingleTimeCommandBuffer::operator=(SingleTimeCommandBuf
 
 CommandPool::CommandPool()
     : __commandPool(VK_NULL_HANDLE)
+    , __queueFamilyIndex(UINT32_MAX)
+    , __queue(nullptr)
 {
 }
 
@@ -316,13 +447,18 @@ bool CommandPool::IsReady() const
     return true;
 }
 
-void CommandPool::SetQueue(Queue* queue)
+void CommandPool::SetQueue(const Queue* queue)
 {
     __queue = queue;
 }
 
 CommandPool::CommandPool(CommandPool&& other)
     : __commandPool(other.__commandPool)
+    , __queueFamilyIndex(other.__queueFamilyIndex)
+    , __commandBuffers(std::move(other.__commandBuffers))
+    , __freeCommandBuffers{std::move(other.__freeCommandBuffers[0]), std::move(other.__freeCommandBuffers[1])}
+    , __acquiredCommandBuffers{std::move(other.__acquiredCommandBuffers[0]), std::move(other.__acquiredCommandBuffers[1])}
+    , __queue(other.__queue)
 {
     other.__commandPool = VK_NULL_HANDLE;
 }
@@ -331,21 +467,29 @@ CommandPool& CommandPool::operator=(CommandPool&& other)
 {
     if (this == &other) return *this;
     __commandPool = other.__commandPool;
+    __queueFamilyIndex = other.__queueFamilyIndex;
+    __commandBuffers = std::move(other.__commandBuffers);
+    for (int i = 0; i < 2; ++i) {
+        __freeCommandBuffers[i] = std::move(other.__freeCommandBuffers[i]);
+        __acquiredCommandBuffers[i] = std::move(other.__acquiredCommandBuffers[i]);
+    }
+    __queue = other.__queue;
     other.__commandPool = VK_NULL_HANDLE;
     return *this;
 }
 
-vc::Error CommandPool::Init(QueueFamilyIndex queueFamilyIndex)
+vc::Error CommandPool::Init(QueueFamilyIndex queueFamilyIndex, VkCommandPoolCreateFlags flags)
 {
     VkCommandPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.flags = flags;
     poolInfo.queueFamilyIndex = queueFamilyIndex;
 
     if (vkCreateCommandPool(LogicalDevice::GetVkDevice(), &poolInfo, Allocator::GetVKAllocationCallbacks(), &__commandPool) != VK_SUCCESS) {
         vc::Log::Error("Failed to create command pool with queue family index: %u", queueFamilyIndex);
         return vc::Error::Failure;
     }
+    __queueFamilyIndex = queueFamilyIndex;
     return vc::Error::Success;
 }
 
@@ -384,4 +528,41 @@ vc::Error CommandPool::CreateSingleTimeCommandBuffer(SingleTimeCommandBuffer & c
     commandBuffer.BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
     return vc::Error::Success;
 }
+
+vc::Error CommandPool::AcquireCommandBuffer(CommandBuffer** commandBuffer, VkCommandBufferLevel level)
+{
+    venom_assert(level == VK_COMMAND_BUFFER_LEVEL_PRIMARY || level == VK_COMMAND_BUFFER_LEVEL_SECONDARY, "Invalid command buffer level");
+    std::vector<CommandBuffer *> & freeList = __freeCommandBuffers[level];
+    if (freeList.empty()) {
+        // Only allocates until the pool reached its steady state
+        CommandBuffer * newCommandBuffer = nullptr;
+        if (vc::Error err = CreateCommandBuffer(&newCommandBuffer, level); err != vc::Error::Success)
+            return err;
+        freeList.push_back(newCommandBuffer);
+    }
+    *commandBuffer = freeList.back();
+    freeList.pop_back();
+    __acquiredCommandBuffers[level].push_back(*commandBuffer);
+    return vc::Error::Success;
+}
+
+vc::Error CommandPool::Reset(VkCommandPoolResetFlags flags)
+{
+    if (VkResult res = vkResetCommandPool(LogicalDevice::GetVkDevice(), __commandPool, flags); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to reset command pool: %d", res);
+        return vc::Error::Failure;
+    }
+    for (int i = 0; i < 2; ++i) {
+        for (CommandBuffer * commandBuffer : __acquiredCommandBuffers[i])
+            commandBuffer->_isActive = false;
+        __freeCommandBuffers[i].insert(__freeCommandBuffers[i].end(), __acquiredCommandBuffers[i].begin(), __acquiredCommandBuffers[i].end());
+        __acquiredCommandBuffers[i].clear();
+    }
+    return vc::Error::Success;
+}
+
+uint32_t CommandPool::GetQueueFamilyIndex() const
+{
+    return __queueFamilyIndex;
+}
 }
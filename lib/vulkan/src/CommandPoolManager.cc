@@ -8,11 +8,14 @@
 #include <venom/vulkan/CommandPoolManager.h>
 #include <venom/vulkan/QueueManager.h>
 
+#include <venom/common/ThreadPool.h>
+
 namespace venom
 {
 namespace vulkan
 {
 static CommandPoolManager * s_commandPoolManager = nullptr;
+
 CommandPoolManager::CommandPoolManager()
     : __graphicsPool(nullptr)
     , __computePool(nullptr)
@@ -22,6 +25,7 @@ CommandPoolManager::CommandPoolManager()
     , __protectedPool(nullptr)
     , __videoDecodePool(nullptr)
     , __videoEncodePool(nullptr)
+    , __currentFrame(0)
 {
     s_commandPoolManager = this;
 }
@@ -73,6 +77,57 @@ vc::Error CommandPoolManager::Init()
     return vc::Error::Success;
 }
 
+vc::Error CommandPoolManager::InitFrameCommandPools(const uint32_t frameCount)
+{
+    std::lock_guard<std::mutex> lock(__framePoolsMutex);
+    // Fixed number of recording threads, their pools are kept from one frame to the next
+    const size_t threadCount = vc::ThreadPool::GetGlobalThreadPool()->GetThreadCount() + 1;
+    __framePools.clear();
+    __framePools.resize(frameCount);
+    for (auto & threadPools : __framePools)
+        threadPools.resize(threadCount);
+    __renderThreadId = std::this_thread::get_id();
+    __currentFrame = 0;
+    return vc::Error::Success;
+}
+
+vc::Error CommandPoolManager::BeginFrame(const uint32_t frameIndex)
+{
+    CommandPoolManager * self = s_commandPoolManager;
+    std::lock_guard<std::mutex> lock(self->__framePoolsMutex);
+    venom_assert(frameIndex < self->__framePools.size(), "Frame index out of range");
+    self->__currentFrame = frameIndex;
+    for (auto & pool : self->__framePools[frameIndex]) {
+        if (!pool)
+            continue;
+        if (vc::Error err = pool->Reset(); err != vc::Error::Success)
+            return err;
+    }
+    return vc::Error::Success;
+}
+
+CommandPool* CommandPoolManager::GetFrameCommandPool()
+{
+    CommandPoolManager * self = s_commandPoolManager;
+    std::lock_guard<std::mutex> lock(self->__framePoolsMutex);
+    venom_assert(!self->__framePools.empty(), "Frame command pools not initialized");
+    const int32_t workerIndex = vc::ThreadPool::GetGlobalThreadPool()->GetWorkerIndex();
+    venom_assert(workerIndex >= 0 || std::this_thread::get_id() == self->__renderThreadId,
+        "Frame command pools are only for the render thread and the global thread pool's workers");
+    std::unique_ptr<CommandPool> & pool = self->__framePools[self->__currentFrame][workerIndex + 1];
+    if (!pool) {
+        // Command buffers of these pools only live for one frame
+        pool = std::make_unique<CommandPool>();
+        const Queue & graphicsQueue = QueueManager::GetGraphicsQueue();
+        if (pool->Init(graphicsQueue.GetQueueFamilyIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT) != vc::Error::Success) {
+            pool.reset();
+            return nullptr;
+        }
+        pool->SetQueue(&graphicsQueue);
+    }
+    return pool.get();
+}
+
 CommandPool* CommandPoolManager::GetGraphicsCommandPool() { return s_commandPoolManager->__graphicsPool; }
 CommandPool* CommandPoolManager::GetComputeCommandPool() { return s_commandPoolManager->__computePool; }
 CommandPool* CommandPoolManager::GetTransferCommandPool() { return s_commandPoolManager->__transferPool; }
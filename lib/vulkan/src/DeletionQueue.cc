@@ -0,0 +1,171 @@
+///
+/// Project: VenomEngine
+/// @file DeletionQueue.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DeletionQueue.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+namespace venom
+{
+namespace vulkan
+{
+static DeletionQueue * s_deletionQueue = nullptr;
+
+DeletionQueue::DeletionQueue()
+{
+    s_deletionQueue = this;
+}
+
+DeletionQueue::~DeletionQueue()
+{
+    __Flush();
+    s_deletionQueue = nullptr;
+}
+
+void DeletionQueue::DestroyBuffer(VkBuffer buffer, DeviceMemoryAllocation* allocation)
+{
+    __Push(HandleType::Buffer, (uint64_t)buffer, allocation);
+}
+
+void DeletionQueue::DestroyImage(VkImage image, DeviceMemoryAllocation* allocation)
+{
+    __Push(HandleType::Image, (uint64_t)image, allocation);
+}
+
+void DeletionQueue::DestroyImageView(VkImageView imageView)
+{
+    __Push(HandleType::ImageView, (uint64_t)imageView, nullptr);
+}
+
+void DeletionQueue::DestroySampler(VkSampler sampler)
+{
+    __Push(HandleType::Sampler, (uint64_t)sampler, nullptr);
+}
+
+void DeletionQueue::DestroyPipeline(VkPipeline pipeline)
+{
+    __Push(HandleType::Pipeline, (uint64_t)pipeline, nullptr);
+}
+
+void DeletionQueue::DestroyPipelineLayout(VkPipelineLayout pipelineLayout)
+{
+    __Push(HandleType::PipelineLayout, (uint64_t)pipelineLayout, nullptr);
+}
+
+void DeletionQueue::DestroyDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout)
+{
+    __Push(HandleType::DescriptorSetLayout, (uint64_t)descriptorSetLayout, nullptr);
+}
+
+void DeletionQueue::DestroyFramebuffer(VkFramebuffer framebuffer)
+{
+    __Push(HandleType::Framebuffer, (uint64_t)framebuffer, nullptr);
+}
+
+void DeletionQueue::DestroySwapchain(VkSwapchainKHR swapchain)
+{
+    __Push(HandleType::Swapchain, (uint64_t)swapchain, nullptr);
+}
+
+void DeletionQueue::Update()
+{
+    if (!s_deletionQueue)
+        return;
+    // Queried before locking, the upload manager may push handles while holding its own lock
+    const FrameValue completedFrame = FrameSync::GetCompletedFrameValue();
+    const UploadHandle completedUpload = UploadManager::GetCompletedHandle();
+
+    std::lock_guard<std::mutex> lock(s_deletionQueue->__mutex);
+    auto & entries = s_deletionQueue->__entries;
+    while (!entries.empty()) {
+        Entry & entry = entries.front();
+        if (entry.frame > completedFrame || entry.upload > completedUpload)
+            break;
+        __Destroy(entry);
+        entries.pop_front();
+    }
+}
+
+void DeletionQueue::Flush()
+{
+    if (s_deletionQueue)
+        s_deletionQueue->__Flush();
+}
+
+void DeletionQueue::__Push(const HandleType type, const uint64_t handle, DeviceMemoryAllocation* allocation)
+{
+    Entry entry {
+        .type = type,
+        .handle = handle,
+        .allocation = allocation ? *allocation : DeviceMemoryAllocation{},
+        .frame = 0,
+        .upload = 0
+    };
+    if (allocation)
+        *allocation = DeviceMemoryAllocation{};
+
+    if (!s_deletionQueue) {
+        __Destroy(entry);
+        return;
+    }
+    // The frame being recorded might still use the handle
+    entry.frame = FrameSync::GetCurrentFrameValue();
+    entry.upload = UploadManager::GetLatestHandle();
+    std::lock_guard<std::mutex> lock(s_deletionQueue->__mutex);
+    s_deletionQueue->__entries.emplace_back(entry);
+}
+
+void DeletionQueue::__Destroy(Entry& entry)
+{
+    const VkDevice device = LogicalDevice::GetVkDevice();
+    if (entry.handle != 0) {
+        switch (entry.type)
+        {
+        case HandleType::Buffer:
+            vkDestroyBuffer(device, (VkBuffer)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::Image:
+            vkDestroyImage(device, (VkImage)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::ImageView:
+            vkDestroyImageView(device, (VkImageView)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::Sampler:
+            vkDestroySampler(device, (VkSampler)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::Pipeline:
+            vkDestroyPipeline(device, (VkPipeline)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::PipelineLayout:
+            vkDestroyPipelineLayout(device, (VkPipelineLayout)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::DescriptorSetLayout:
+            vkDestroyDescriptorSetLayout(device, (VkDescriptorSetLayout)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::Framebuffer:
+            vkDestroyFramebuffer(device, (VkFramebuffer)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        case HandleType::Swapchain:
+            vkDestroySwapchainKHR(device, (VkSwapchainKHR)entry.handle, Allocator::GetVKAllocationCallbacks());
+            break;
+        }
+    }
+    DeviceMemoryAllocator::Free(&entry.allocation);
+}
+
+void DeletionQueue::__Flush()
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    if (__entries.empty())
+        return;
+    vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+    for (Entry & entry : __entries)
+        __Destroy(entry);
+    __entries.clear();
+}
+}
+}
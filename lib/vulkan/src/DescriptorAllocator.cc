@@ -0,0 +1,160 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorAllocator.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DescriptorAllocator.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+#include <array>
+
+namespace venom
+{
+namespace vulkan
+{
+static DescriptorAllocator * s_descriptorAllocator = nullptr;
+
+/// @brief Descriptors per set for each type, pools hold this many times their number of sets
+static constexpr std::array<std::pair<VkDescriptorType, float>, 7> s_poolSizeRatios = {{
+    {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0f},
+    {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0f},
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2.0f},
+    {VK_DESCRIPTOR_TYPE_SAMPLER, 1.0f},
+    {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4.0f},
+    {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0f},
+    {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.0f}
+}};
+
+DescriptorAllocator::DescriptorAllocator()
+    : __currentFrame(0)
+    , __setsPerPool(MIN_SETS_PER_POOL)
+    , __poolCount(0)
+{
+    s_descriptorAllocator = this;
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+    Destroy();
+    s_descriptorAllocator = nullptr;
+}
+
+vc::Error DescriptorAllocator::Init(const uint32_t frameCount)
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    __framePools.resize(frameCount);
+    __currentFrame = 0;
+    return vc::Error::Success;
+}
+
+void DescriptorAllocator::Destroy()
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    // The device is idle by now, sets are freed with their pool
+    for (std::vector<VkDescriptorPool> & pools : __framePools) {
+        __freePools.insert(__freePools.end(), pools.begin(), pools.end());
+        pools.clear();
+    }
+    for (const VkDescriptorPool pool : __freePools)
+        vkDestroyDescriptorPool(LogicalDevice::GetVkDevice(), pool, Allocator::GetVKAllocationCallbacks());
+    __freePools.clear();
+    __framePools.clear();
+    __poolCount = 0;
+    __setsPerPool = MIN_SETS_PER_POOL;
+}
+
+vc::Error DescriptorAllocator::BeginFrame(const uint32_t frameIndex)
+{
+    DescriptorAllocator * self = s_descriptorAllocator;
+    std::lock_guard<std::mutex> lock(self->__mutex);
+    venom_assert(frameIndex < self->__framePools.size(), "Frame index out of range");
+    self->__currentFrame = frameIndex;
+    for (const VkDescriptorPool pool : self->__framePools[frameIndex]) {
+        if (VkResult res = vkResetDescriptorPool(LogicalDevice::GetVkDevice(), pool, 0); res != VK_SUCCESS) {
+            vc::Log::Error("Failed to reset descriptor pool: %d", res);
+            return vc::Error::Failure;
+        }
+        self->__freePools.emplace_back(pool);
+    }
+    self->__framePools[frameIndex].clear();
+    return vc::Error::Success;
+}
+
+DescriptorSet DescriptorAllocator::AllocateFrameSet(VkDescriptorSetLayout layout)
+{
+    DescriptorAllocator * self = s_descriptorAllocator;
+    DescriptorSet set;
+    venom_assert(self && !self->__framePools.empty(), "DescriptorAllocator not initialized");
+    std::lock_guard<std::mutex> lock(self->__mutex);
+    std::vector<VkDescriptorPool> & pools = self->__framePools[self->__currentFrame];
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+    // At most twice: in the current pool, then in a fresh one
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (pools.empty() || attempt > 0) {
+            const VkDescriptorPool pool = self->__AcquirePool();
+            if (pool == VK_NULL_HANDLE)
+                return set;
+            pools.emplace_back(pool);
+        }
+        allocInfo.descriptorPool = pools.back();
+        const VkResult res = vkAllocateDescriptorSets(LogicalDevice::GetVkDevice(), &allocInfo, &set.__set);
+        if (res == VK_SUCCESS)
+            return set;
+        if (res != VK_ERROR_OUT_OF_POOL_MEMORY && res != VK_ERROR_FRAGMENTED_POOL) {
+            vc::Log::Error("Failed to allocate frame descriptor set: %d", res);
+            break;
+        }
+    }
+    set.__set = VK_NULL_HANDLE;
+    return set;
+}
+
+size_t DescriptorAllocator::GetPoolCount()
+{
+    if (!s_descriptorAllocator)
+        return 0;
+    std::lock_guard<std::mutex> lock(s_descriptorAllocator->__mutex);
+    return s_descriptorAllocator->__poolCount;
+}
+
+VkDescriptorPool DescriptorAllocator::__AcquirePool()
+{
+    if (!__freePools.empty()) {
+        const VkDescriptorPool pool = __freePools.back();
+        __freePools.pop_back();
+        return pool;
+    }
+
+    VENOM_TRACE_FUNCTION();
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    for (const auto & [type, ratio] : s_poolSizeRatios)
+        poolSizes.push_back({type, static_cast<uint32_t>(ratio * __setsPerPool)});
+    VkDescriptorPoolCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    createInfo.flags = 0;
+    createInfo.maxSets = __setsPerPool;
+    createInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    createInfo.pPoolSizes = poolSizes.data();
+    VkDescriptorPool pool;
+    if (VkResult res = vkCreateDescriptorPool(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &pool); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create descriptor pool: %d", res);
+        return VK_NULL_HANDLE;
+    }
+    ++__poolCount;
+    DEBUG_LOG("DescriptorAllocator: new pool of %u sets (%zu pools)", __setsPerPool, __poolCount);
+    // Frames that needed a new pool are likely to need a larger one again
+    __setsPerPool = std::min(__setsPerPool * 2, MAX_SETS_PER_POOL);
+    return pool;
+}
+}
+}
@@ -7,8 +7,7 @@
 ///
 #include <venom/vulkan/DescriptorSetLayout.h>
 
-#include <venom/vulkan/LogicalDevice.h>
-#include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DeviceObjectCache.h>
 
 namespace venom
 {
@@ -23,9 +22,7 @@ DescriptorSetLayout::DescriptorSetLayout()
 
 DescriptorSetLayout::~DescriptorSetLayout()
 {
-    if (__layout != VK_NULL_HANDLE) {
-        vkDestroyDescriptorSetLayout(LogicalDevice::GetVkDevice(), __layout, Allocator::GetVKAllocationCallbacks());
-    }
+    DeviceObjectCache::Release(__layout);
 }
 
 void DescriptorSetLayout::AddBinding(uint32_t binding, VkDescriptorType type, uint32_t count,
@@ -39,10 +36,9 @@ void DescriptorSetLayout::AddBinding(uint32_t binding, VkDescriptorType type, ui
 vc::Error DescriptorSetLayout::Create(VkDescriptorSetLayoutCreateFlags flags)
 {
     __descriptorSetLayoutInfo.flags = flags;
-    if (auto err = vkCreateDescriptorSetLayout(LogicalDevice::GetVkDevice(), &__descriptorSetLayoutInfo, Allocator::GetVKAllocationCallbacks(), &__layout); err != VK_SUCCESS) {
-        vc::Log::Error("Failed to create descriptor set layout: %d", err);
+    DeviceObjectCache::Release(__layout);
+    if (__layout = DeviceObjectCache::AcquireDescriptorSetLayout(__bindings, flags); __layout == VK_NULL_HANDLE)
         return vc::Error::Failure;
-    }
     return vc::Error::Success;
 }
 
@@ -0,0 +1,95 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorUpdateTemplate.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DescriptorUpdateTemplate.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+namespace venom
+{
+namespace vulkan
+{
+DescriptorUpdateTemplate::DescriptorUpdateTemplate()
+    : __template(VK_NULL_HANDLE)
+{
+}
+
+DescriptorUpdateTemplate::~DescriptorUpdateTemplate()
+{
+    Destroy();
+}
+
+DescriptorUpdateTemplate::DescriptorUpdateTemplate(DescriptorUpdateTemplate&& other) noexcept
+    : __entries(std::move(other.__entries))
+    , __template(other.__template)
+{
+    other.__template = VK_NULL_HANDLE;
+}
+
+DescriptorUpdateTemplate& DescriptorUpdateTemplate::operator=(DescriptorUpdateTemplate&& other) noexcept
+{
+    if (this != &other) {
+        Destroy();
+        __entries = std::move(other.__entries);
+        __template = other.__template;
+        other.__template = VK_NULL_HANDLE;
+    }
+    return *this;
+}
+
+void DescriptorUpdateTemplate::AddEntry(uint32_t binding, VkDescriptorType descriptorType, size_t offset, uint32_t descriptorCount, size_t stride)
+{
+    const bool isBuffer = descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+        || descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER || descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    __entries.push_back({
+        .dstBinding = binding,
+        .dstArrayElement = 0,
+        .descriptorCount = descriptorCount,
+        .descriptorType = descriptorType,
+        .offset = offset,
+        .stride = stride != 0 ? stride : (isBuffer ? sizeof(VkDescriptorBufferInfo) : sizeof(VkDescriptorImageInfo))
+    });
+}
+
+vc::Error DescriptorUpdateTemplate::Create(VkDescriptorSetLayout layout)
+{
+    Destroy();
+    VkDescriptorUpdateTemplateCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(__entries.size());
+    createInfo.pDescriptorUpdateEntries = __entries.data();
+    createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout = layout;
+    if (VkResult res = vkCreateDescriptorUpdateTemplate(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__template); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create descriptor update template: %d", res);
+        __template = VK_NULL_HANDLE;
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+void DescriptorUpdateTemplate::Destroy()
+{
+    // Only used on the host, no need to wait for the GPU
+    if (__template != VK_NULL_HANDLE) {
+        vkDestroyDescriptorUpdateTemplate(LogicalDevice::GetVkDevice(), __template, Allocator::GetVKAllocationCallbacks());
+        __template = VK_NULL_HANDLE;
+    }
+}
+
+void DescriptorUpdateTemplate::Update(VkDescriptorSet set, const void* data) const
+{
+    venom_assert(__template != VK_NULL_HANDLE, "DescriptorUpdateTemplate not created");
+    vkUpdateDescriptorSetWithTemplate(LogicalDevice::GetVkDevice(), set, __template, data);
+}
+
+bool DescriptorUpdateTemplate::IsCreated() const
+{
+    return __template != VK_NULL_HANDLE;
+}
+}
+}
@@ -0,0 +1,143 @@
+///
+/// Project: VenomEngine
+/// @file DescriptorWriter.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DescriptorWriter.h>
+#include <venom/vulkan/LogicalDevice.h>
+
+#include <venom/common/Trace.h>
+
+namespace venom
+{
+namespace vulkan
+{
+DescriptorWriter::DescriptorWriter()
+{
+}
+
+DescriptorWriter::~DescriptorWriter()
+{
+    venom_assert(__pendingWrites.empty(), "DescriptorWriter destroyed with pending writes");
+}
+
+DescriptorWriter& DescriptorWriter::WriteBuffer(VkDescriptorSet set, uint32_t binding, VkDescriptorType descriptorType,
+    VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range, uint32_t arrayElement)
+{
+    __bufferInfos.push_back({
+        .buffer = buffer,
+        .offset = offset,
+        .range = range
+    });
+    __pendingWrites.push_back({
+        .write = {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext = nullptr,
+            .dstSet = set,
+            .dstBinding = binding,
+            .dstArrayElement = arrayElement,
+            .descriptorCount = 1,
+            .descriptorType = descriptorType
+        },
+        .infoIndex = __bufferInfos.size() - 1,
+        .isImage = false
+    });
+    return *this;
+}
+
+DescriptorWriter& DescriptorWriter::WriteImage(VkDescriptorSet set, uint32_t binding, VkDescriptorType descriptorType,
+    VkImageView imageView, VkImageLayout imageLayout, uint32_t arrayElement)
+{
+    __imageInfos.push_back({
+        .sampler = VK_NULL_HANDLE,
+        .imageView = imageView,
+        .imageLayout = imageLayout
+    });
+    __pendingWrites.push_back({
+        .write = {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext = nullptr,
+            .dstSet = set,
+            .dstBinding = binding,
+            .dstArrayElement = arrayElement,
+            .descriptorCount = 1,
+            .descriptorType = descriptorType
+        },
+        .infoIndex = __imageInfos.size() - 1,
+        .isImage = true
+    });
+    return *this;
+}
+
+DescriptorWriter& DescriptorWriter::WriteSampler(VkDescriptorSet set, uint32_t binding, VkSampler sampler, uint32_t arrayElement)
+{
+    __imageInfos.push_back({
+        .sampler = sampler
+    });
+    __pendingWrites.push_back({
+        .write = {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext = nullptr,
+            .dstSet = set,
+            .dstBinding = binding,
+            .dstArrayElement = arrayElement,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER
+        },
+        .infoIndex = __imageInfos.size() - 1,
+        .isImage = true
+    });
+    return *this;
+}
+
+DescriptorWriter& DescriptorWriter::WriteBuffer(const DescriptorSet& set, uint32_t binding, const UniformBuffer& buffer,
+    uint32_t bufferOffset, uint32_t bufferRange, VkDescriptorType descriptorType)
+{
+    return WriteBuffer(set.GetVkDescriptorSet(), binding, descriptorType, buffer.GetVkBuffer(), bufferOffset, bufferRange);
+}
+
+DescriptorWriter& DescriptorWriter::WriteTexture(const DescriptorSet& set, uint32_t binding, const VulkanTexture* texture,
+    VkDescriptorType descriptorType)
+{
+    return WriteImage(set.GetVkDescriptorSet(), binding, descriptorType, texture->GetImageView().GetVkImageView(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+DescriptorWriter& DescriptorWriter::WriteSampler(const DescriptorSet& set, uint32_t binding, const Sampler& sampler)
+{
+    return WriteSampler(set.GetVkDescriptorSet(), binding, sampler.GetVkSampler());
+}
+
+void DescriptorWriter::Flush()
+{
+    if (__pendingWrites.empty())
+        return;
+    VENOM_TRACE_FUNCTION();
+    // Infos won't move anymore
+    __writes.clear();
+    __writes.reserve(__pendingWrites.size());
+    for (const PendingWrite & pending : __pendingWrites) {
+        VkWriteDescriptorSet & write = __writes.emplace_back(pending.write);
+        if (pending.isImage)
+            write.pImageInfo = &__imageInfos[pending.infoIndex];
+        else
+            write.pBufferInfo = &__bufferInfos[pending.infoIndex];
+    }
+    vkUpdateDescriptorSets(LogicalDevice::GetVkDevice(), static_cast<uint32_t>(__writes.size()), __writes.data(), 0, nullptr);
+    Clear();
+}
+
+void DescriptorWriter::Clear()
+{
+    __pendingWrites.clear();
+    __bufferInfos.clear();
+    __imageInfos.clear();
+}
+
+size_t DescriptorWriter::GetWriteCount() const
+{
+    return __pendingWrites.size();
+}
+}
+}
@@ -0,0 +1,354 @@
+///
+/// Project: VenomEngine
+/// @file DeviceMemoryAllocator.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DeviceMemoryAllocator.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static DeviceMemoryAllocator * s_deviceMemoryAllocator = nullptr;
+
+static inline VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+DeviceMemoryBlock::DeviceMemoryBlock(const uint32_t memoryTypeIndex, const VkDeviceSize size)
+    : __memory(VK_NULL_HANDLE)
+    , __size(size)
+    , __usedSize(0)
+    , __memoryTypeIndex(memoryTypeIndex)
+    , __mappedData(nullptr)
+{
+}
+
+DeviceMemoryBlock::~DeviceMemoryBlock()
+{
+    if (__memory != VK_NULL_HANDLE) {
+        if (__mappedData)
+            vkUnmapMemory(LogicalDevice::GetVkDevice(), __memory);
+        vkFreeMemory(LogicalDevice::GetVkDevice(), __memory, Allocator::GetVKAllocationCallbacks());
+    }
+}
+
+vc::Error DeviceMemoryBlock::Init(const bool hostVisible)
+{
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = __size;
+    allocInfo.memoryTypeIndex = __memoryTypeIndex;
+
+    if (VkResult vkErr = vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &__memory); vkErr != VK_SUCCESS) {
+        vc::Log::Error("Failed to allocate device memory block of %" PRIu64 "MB: %d", __size / (1024 * 1024), vkErr);
+        return vc::Error::OutOfMemory;
+    }
+    // Blocks are mapped once for their whole lifetime, a VkDeviceMemory can't be mapped twice
+    if (hostVisible) {
+        if (VkResult vkErr = vkMapMemory(LogicalDevice::GetVkDevice(), __memory, 0, VK_WHOLE_SIZE, 0, &__mappedData); vkErr != VK_SUCCESS) {
+            vc::Log::Error("Failed to map device memory block: %d", vkErr);
+            return vc::Error::Failure;
+        }
+    }
+    __freeRanges[0] = __size;
+    return vc::Error::Success;
+}
+
+bool DeviceMemoryBlock::Allocate(const VkDeviceSize size, const VkDeviceSize alignment, VkDeviceSize* offset)
+{
+    for (auto ite = __freeRanges.begin(); ite != __freeRanges.end(); ++ite) {
+        const VkDeviceSize rangeOffset = ite->first;
+        const VkDeviceSize rangeSize = ite->second;
+        const VkDeviceSize alignedOffset = AlignUp(rangeOffset, alignment);
+        if (alignedOffset + size > rangeOffset + rangeSize)
+            continue;
+
+        __freeRanges.erase(ite);
+        // Keep alignment padding and what is left after the allocation as free ranges
+        if (alignedOffset > rangeOffset)
+            __freeRanges[rangeOffset] = alignedOffset - rangeOffset;
+        if (alignedOffset + size < rangeOffset + rangeSize)
+            __freeRanges[alignedOffset + size] = rangeOffset + rangeSize - (alignedOffset + size);
+        __usedSize += size;
+        *offset = alignedOffset;
+        return true;
+    }
+    return false;
+}
+
+void DeviceMemoryBlock::Free(const VkDeviceSize offset, const VkDeviceSize size)
+{
+    venom_assert(__usedSize >= size, "DeviceMemoryBlock::Free() : freeing more than allocated");
+    __usedSize -= size;
+
+    auto ite = __freeRanges.emplace(offset, size).first;
+    // Coalesce with next range
+    auto next = std::next(ite);
+    if (next != __freeRanges.end() && ite->first + ite->second == next->first) {
+        ite->second += next->second;
+        __freeRanges.erase(next);
+    }
+    // Coalesce with previous range
+    if (ite != __freeRanges.begin()) {
+        auto prev = std::prev(ite);
+        if (prev->first + prev->second == ite->first) {
+            prev->second += ite->second;
+            __freeRanges.erase(ite);
+        }
+    }
+}
+
+bool DeviceMemoryBlock::IsEmpty() const
+{
+    return __usedSize == 0;
+}
+
+VkDeviceMemory DeviceMemoryBlock::GetVkDeviceMemory() const
+{
+    return __memory;
+}
+
+VkDeviceSize DeviceMemoryBlock::GetSize() const
+{
+    return __size;
+}
+
+VkDeviceSize DeviceMemoryBlock::GetUsedSize() const
+{
+    return __usedSize;
+}
+
+uint32_t DeviceMemoryBlock::GetMemoryTypeIndex() const
+{
+    return __memoryTypeIndex;
+}
+
+void* DeviceMemoryBlock::GetMappedData() const
+{
+    return __mappedData;
+}
+
+DeviceMemoryAllocator::DeviceMemoryAllocator()
+    : __memoryProperties{}
+    , __preferredBlockSize(DEFAULT_BLOCK_SIZE)
+    , __bufferImageGranularity(1)
+{
+    s_deviceMemoryAllocator = this;
+}
+
+DeviceMemoryAllocator::~DeviceMemoryAllocator()
+{
+    Destroy();
+    s_deviceMemoryAllocator = nullptr;
+}
+
+vc::Error DeviceMemoryAllocator::Init(const VkDeviceSize blockSize)
+{
+    __memoryProperties = PhysicalDevice::GetUsedPhysicalDevice().GetMemoryProperties();
+    __bufferImageGranularity = std::max<VkDeviceSize>(1, PhysicalDevice::GetUsedPhysicalDevice().GetProperties().limits.bufferImageGranularity);
+    __preferredBlockSize = blockSize;
+    return vc::Error::Success;
+}
+
+void DeviceMemoryAllocator::Destroy()
+{
+#ifdef VENOM_DEBUG
+    for (uint32_t i = 0; i < __memoryProperties.memoryHeapCount; ++i) {
+        if (__heapStats[i].allocationCount != 0)
+            vc::Log::Error("DeviceMemoryAllocator: %u allocation(s) still alive in heap %u", __heapStats[i].allocationCount, i);
+    }
+#endif
+    for (auto & blocks : __blocks)
+        blocks.clear();
+}
+
+vc::Error DeviceMemoryAllocator::Allocate(const VkMemoryRequirements& requirements, const VkMemoryPropertyFlags properties, const bool dedicated, DeviceMemoryAllocation* allocation)
+{
+    venom_assert(s_deviceMemoryAllocator, "DeviceMemoryAllocator not created");
+    DeviceMemoryAllocator * self = s_deviceMemoryAllocator;
+
+    const uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+    if (memoryTypeIndex == UINT32_MAX) {
+        vc::Log::Error("Failed to find a suitable memory type");
+        return vc::Error::Failure;
+    }
+
+    std::lock_guard<std::mutex> lock(self->__mutex);
+    const VkDeviceSize blockSize = self->__GetBlockSize(memoryTypeIndex);
+    if (dedicated || requirements.size > blockSize / DEDICATED_THRESHOLD_DIVISOR)
+        return self->__AllocateDedicated(requirements.size, memoryTypeIndex, allocation);
+
+    // Rounding to bufferImageGranularity keeps linear and optimal resources on separate pages
+    const VkDeviceSize alignment = std::max(requirements.alignment, self->__bufferImageGranularity);
+    const VkDeviceSize size = AlignUp(requirements.size, self->__bufferImageGranularity);
+    const uint32_t heapIndex = self->__memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    auto & blocks = self->__blocks[memoryTypeIndex];
+
+    DeviceMemoryBlock * block = nullptr;
+    VkDeviceSize offset = 0;
+    for (auto & b : blocks) {
+        if (b->Allocate(size, alignment, &offset)) {
+            block = b.get();
+            break;
+        }
+    }
+    if (!block) {
+        auto newBlock = std::make_unique<DeviceMemoryBlock>(memoryTypeIndex, blockSize);
+        const bool hostVisible = self->__memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        if (vc::Error err = newBlock->Init(hostVisible); err != vc::Error::Success)
+            return err;
+        if (!newBlock->Allocate(size, alignment, &offset)) {
+            vc::Log::Error("Failed to sub-allocate %" PRIu64 " bytes from a fresh block", size);
+            return vc::Error::OutOfMemory;
+        }
+        block = newBlock.get();
+        blocks.emplace_back(std::move(newBlock));
+        ++self->__heapStats[heapIndex].blockCount;
+        self->__heapStats[heapIndex].reservedBytes += blockSize;
+    }
+
+    allocation->memory = block->GetVkDeviceMemory();
+    allocation->offset = offset;
+    allocation->size = size;
+    allocation->memoryTypeIndex = memoryTypeIndex;
+    allocation->mappedData = block->GetMappedData() ? static_cast<char *>(block->GetMappedData()) + offset : nullptr;
+    allocation->block = block;
+    ++self->__heapStats[heapIndex].allocationCount;
+    self->__heapStats[heapIndex].usedBytes += size;
+    return vc::Error::Success;
+}
+
+vc::Error DeviceMemoryAllocator::AllocateForBuffer(const VkBuffer buffer, const VkMemoryPropertyFlags properties, DeviceMemoryAllocation* allocation)
+{
+    VkMemoryRequirements memRequirements;
+    vkGetBufferMemoryRequirements(LogicalDevice::GetVkDevice(), buffer, &memRequirements);
+    return Allocate(memRequirements, properties, false, allocation);
+}
+
+vc::Error DeviceMemoryAllocator::AllocateForImage(const VkImage image, const VkMemoryPropertyFlags properties, DeviceMemoryAllocation* allocation)
+{
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(LogicalDevice::GetVkDevice(), image, &memRequirements);
+    return Allocate(memRequirements, properties, false, allocation);
+}
+
+void DeviceMemoryAllocator::Free(DeviceMemoryAllocation* allocation)
+{
+    if (!allocation->IsValid())
+        return;
+    venom_assert(s_deviceMemoryAllocator, "DeviceMemoryAllocator not created");
+    DeviceMemoryAllocator * self = s_deviceMemoryAllocator;
+
+    std::lock_guard<std::mutex> lock(self->__mutex);
+    const uint32_t heapIndex = self->__memoryProperties.memoryTypes[allocation->memoryTypeIndex].heapIndex;
+    DeviceMemoryHeapStats & stats = self->__heapStats[heapIndex];
+    --stats.allocationCount;
+    stats.usedBytes -= allocation->size;
+
+    if (allocation->IsDedicated()) {
+        if (allocation->mappedData)
+            vkUnmapMemory(LogicalDevice::GetVkDevice(), allocation->memory);
+        vkFreeMemory(LogicalDevice::GetVkDevice(), allocation->memory, Allocator::GetVKAllocationCallbacks());
+        --stats.dedicatedAllocationCount;
+        stats.reservedBytes -= allocation->size;
+    } else {
+        allocation->block->Free(allocation->offset, allocation->size);
+        // Release empty blocks but always keep one around per memory type to avoid thrashing
+        auto & blocks = self->__blocks[allocation->memoryTypeIndex];
+        if (allocation->block->IsEmpty() && blocks.size() > 1) {
+            auto ite = std::find_if(blocks.begin(), blocks.end(), [allocation](const std::unique_ptr<DeviceMemoryBlock> & b) { return b.get() == allocation->block; });
+            --stats.blockCount;
+            stats.reservedBytes -= (*ite)->GetSize();
+            blocks.erase(ite);
+        }
+    }
+    *allocation = DeviceMemoryAllocation{};
+}
+
+uint32_t DeviceMemoryAllocator::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+{
+    const VkPhysicalDeviceMemoryProperties & memProperties = PhysicalDevice::GetUsedPhysicalDevice().GetMemoryProperties();
+    for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i) {
+        if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+DeviceMemoryHeapStats DeviceMemoryAllocator::GetHeapStats(const uint32_t heapIndex)
+{
+    venom_assert(heapIndex < VK_MAX_MEMORY_HEAPS, "Heap index out of range");
+    std::lock_guard<std::mutex> lock(s_deviceMemoryAllocator->__mutex);
+    return s_deviceMemoryAllocator->__heapStats[heapIndex];
+}
+
+uint32_t DeviceMemoryAllocator::GetHeapCount()
+{
+    return s_deviceMemoryAllocator->__memoryProperties.memoryHeapCount;
+}
+
+void DeviceMemoryAllocator::LogStats()
+{
+    for (uint32_t i = 0; i < GetHeapCount(); ++i) {
+        const DeviceMemoryHeapStats stats = GetHeapStats(i);
+        vc::Log::Print("Heap %u: %u block(s), %u dedicated, %u allocation(s), %" PRIu64 "KB used / %" PRIu64 "KB reserved",
+            i, stats.blockCount, stats.dedicatedAllocationCount, stats.allocationCount,
+            stats.usedBytes / 1024, stats.reservedBytes / 1024);
+    }
+}
+
+VkDeviceSize DeviceMemoryAllocator::__GetBlockSize(const uint32_t memoryTypeIndex) const
+{
+    // Small heaps (e.g. 256MB BAR heap) would be exhausted by a couple of default blocks
+    const uint32_t heapIndex = __memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    const VkDeviceSize heapSize = __memoryProperties.memoryHeaps[heapIndex].size;
+    return std::min(__preferredBlockSize, AlignUp(heapSize / 8, 1024));
+}
+
+vc::Error DeviceMemoryAllocator::__AllocateDedicated(const VkDeviceSize size, const uint32_t memoryTypeIndex, DeviceMemoryAllocation* allocation)
+{
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    VkDeviceMemory memory;
+    if (VkResult vkErr = vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &memory); vkErr != VK_SUCCESS) {
+        vc::Log::Error("Failed to allocate dedicated device memory: %d", vkErr);
+        return vc::Error::OutOfMemory;
+    }
+    void * mappedData = nullptr;
+    if (__memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        if (VkResult vkErr = vkMapMemory(LogicalDevice::GetVkDevice(), memory, 0, VK_WHOLE_SIZE, 0, &mappedData); vkErr != VK_SUCCESS) {
+            vc::Log::Error("Failed to map dedicated device memory: %d", vkErr);
+            vkFreeMemory(LogicalDevice::GetVkDevice(), memory, Allocator::GetVKAllocationCallbacks());
+            return vc::Error::Failure;
+        }
+    }
+
+    allocation->memory = memory;
+    allocation->offset = 0;
+    allocation->size = size;
+    allocation->memoryTypeIndex = memoryTypeIndex;
+    allocation->mappedData = mappedData;
+    allocation->block = nullptr;
+
+    DeviceMemoryHeapStats & stats = __heapStats[__memoryProperties.memoryTypes[memoryTypeIndex].heapIndex];
+    ++stats.dedicatedAllocationCount;
+    ++stats.allocationCount;
+    stats.reservedBytes += size;
+    stats.usedBytes += size;
+    return vc::Error::Success;
+}
+}
+}
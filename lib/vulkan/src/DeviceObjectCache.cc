@@ -0,0 +1,301 @@
+///
+/// Project: VenomEngine
+/// @file DeviceObjectCache.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/DeviceObjectCache.h>
+#include <venom/vulkan/DeletionQueue.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace venom
+{
+namespace vulkan
+{
+static DeviceObjectCache * s_deviceObjectCache = nullptr;
+
+static uint64_t FloatBits(const float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+DeviceObjectCache::DeviceObjectCache()
+{
+    s_deviceObjectCache = this;
+}
+
+DeviceObjectCache::~DeviceObjectCache()
+{
+    Destroy();
+    s_deviceObjectCache = nullptr;
+}
+
+void DeviceObjectCache::Destroy()
+{
+    std::lock_guard<std::mutex> lock(__mutex);
+    if (__objects.empty())
+        return;
+    DEBUG_LOG("DeviceObjectCache: %zu objects still referenced on destruction", __objects.size());
+    // Pipeline layouts first, the device is idle by now
+    for (const ObjectType type : {ObjectType::PipelineLayout, ObjectType::DescriptorSetLayout, ObjectType::Sampler}) {
+        for (const auto & [key, entry] : __objects) {
+            if (static_cast<ObjectType>(key.words[0]) == type)
+                __Destroy(type, entry.handle, false);
+        }
+    }
+    __objects.clear();
+    __keys.clear();
+}
+
+VkSampler DeviceObjectCache::AcquireSampler(const VkSamplerCreateInfo& createInfo)
+{
+    venom_assert(s_deviceObjectCache, "DeviceObjectCache not created");
+    venom_assert(createInfo.pNext == nullptr, "DeviceObjectCache::AcquireSampler() : pNext isn't supported");
+    Key key = __MakeKey({
+        static_cast<uint64_t>(ObjectType::Sampler),
+        createInfo.flags,
+        static_cast<uint64_t>(createInfo.magFilter),
+        static_cast<uint64_t>(createInfo.minFilter),
+        static_cast<uint64_t>(createInfo.mipmapMode),
+        static_cast<uint64_t>(createInfo.addressModeU),
+        static_cast<uint64_t>(createInfo.addressModeV),
+        static_cast<uint64_t>(createInfo.addressModeW),
+        FloatBits(createInfo.mipLodBias),
+        createInfo.anisotropyEnable,
+        FloatBits(createInfo.maxAnisotropy),
+        createInfo.compareEnable,
+        static_cast<uint64_t>(createInfo.compareOp),
+        FloatBits(createInfo.minLod),
+        FloatBits(createInfo.maxLod),
+        static_cast<uint64_t>(createInfo.borderColor),
+        createInfo.unnormalizedCoordinates
+    });
+
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    if (const uint64_t handle = s_deviceObjectCache->__Find(key); handle != 0)
+        return (VkSampler)handle;
+
+    VkSampler sampler;
+    if (VkResult res = vkCreateSampler(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &sampler); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create sampler: %d", res);
+        return VK_NULL_HANDLE;
+    }
+    s_deviceObjectCache->__Insert(std::move(key), (uint64_t)sampler, {});
+    return sampler;
+}
+
+VkDescriptorSetLayout DeviceObjectCache::AcquireDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings, const VkDescriptorSetLayoutCreateFlags flags,
+    const std::vector<VkDescriptorBindingFlags>& bindingFlags)
+{
+    venom_assert(s_deviceObjectCache, "DeviceObjectCache not created");
+    venom_assert(bindingFlags.empty() || bindingFlags.size() == bindings.size(), "DeviceObjectCache::AcquireDescriptorSetLayout() : one binding flag per binding expected");
+    // Sorted with their flags
+    std::vector<std::pair<VkDescriptorSetLayoutBinding, VkDescriptorBindingFlags>> sorted;
+    for (size_t i = 0; i < bindings.size(); ++i)
+        sorted.emplace_back(bindings[i], bindingFlags.empty() ? 0 : bindingFlags[i]);
+    std::sort(sorted.begin(), sorted.end(), [](const auto & a, const auto & b) {
+        return a.first.binding < b.first.binding;
+    });
+    std::vector<VkDescriptorSetLayoutBinding> sortedBindings;
+    std::vector<VkDescriptorBindingFlags> sortedFlags;
+    for (const auto & [binding, bindingFlag] : sorted) {
+        sortedBindings.emplace_back(binding);
+        sortedFlags.emplace_back(bindingFlag);
+    }
+    std::vector<uint64_t> words = {static_cast<uint64_t>(ObjectType::DescriptorSetLayout), flags, sortedBindings.size()};
+    for (size_t i = 0; i < sortedBindings.size(); ++i) {
+        const VkDescriptorSetLayoutBinding & binding = sortedBindings[i];
+        words.insert(words.end(), {binding.binding, static_cast<uint64_t>(binding.descriptorType), binding.descriptorCount, binding.stageFlags, sortedFlags[i]});
+        words.emplace_back(binding.pImmutableSamplers != nullptr);
+        if (binding.pImmutableSamplers) {
+            for (uint32_t j = 0; j < binding.descriptorCount; ++j)
+                words.emplace_back((uint64_t)binding.pImmutableSamplers[j]);
+        }
+    }
+    Key key = __MakeKey(std::move(words));
+
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    if (const uint64_t handle = s_deviceObjectCache->__Find(key); handle != 0)
+        return (VkDescriptorSetLayout)handle;
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+    bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsInfo.bindingCount = static_cast<uint32_t>(sortedFlags.size());
+    bindingFlagsInfo.pBindingFlags = sortedFlags.data();
+    VkDescriptorSetLayoutCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    // Only chained when used, descriptor indexing may not be enabled
+    createInfo.pNext = bindingFlags.empty() ? nullptr : &bindingFlagsInfo;
+    createInfo.flags = flags;
+    createInfo.bindingCount = static_cast<uint32_t>(sortedBindings.size());
+    createInfo.pBindings = sortedBindings.data();
+    VkDescriptorSetLayout layout;
+    if (VkResult res = vkCreateDescriptorSetLayout(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &layout); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create descriptor set layout: %d", res);
+        return VK_NULL_HANDLE;
+    }
+    s_deviceObjectCache->__Insert(std::move(key), (uint64_t)layout, {});
+    return layout;
+}
+
+VkPipelineLayout DeviceObjectCache::AcquirePipelineLayout(const std::vector<VkDescriptorSetLayout>& setLayouts, const std::vector<VkPushConstantRange>& pushConstantRanges)
+{
+    venom_assert(s_deviceObjectCache, "DeviceObjectCache not created");
+    // Set layouts are hash-consed: same handle, same layout
+    std::vector<uint64_t> words = {static_cast<uint64_t>(ObjectType::PipelineLayout), setLayouts.size()};
+    for (const VkDescriptorSetLayout layout : setLayouts)
+        words.emplace_back((uint64_t)layout);
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> ranges;
+    for (const VkPushConstantRange & range : pushConstantRanges)
+        ranges.emplace_back(range.stageFlags, range.offset, range.size);
+    std::sort(ranges.begin(), ranges.end());
+    words.emplace_back(ranges.size());
+    for (const auto & [stages, offset, size] : ranges)
+        words.insert(words.end(), {stages, offset, size});
+    Key key = __MakeKey(std::move(words));
+
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    if (const uint64_t handle = s_deviceObjectCache->__Find(key); handle != 0)
+        return (VkPipelineLayout)handle;
+
+    VkPipelineLayoutCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    createInfo.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+    createInfo.pSetLayouts = setLayouts.data();
+    createInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+    createInfo.pPushConstantRanges = pushConstantRanges.data();
+    VkPipelineLayout layout;
+    if (VkResult res = vkCreatePipelineLayout(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &layout); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create pipeline layout: %d", res);
+        return VK_NULL_HANDLE;
+    }
+
+    // The key holds the set layouts' handles: they must not be destroyed (and their handle reused) while it's cached
+    std::vector<uint64_t> dependencies;
+    for (const VkDescriptorSetLayout setLayout : setLayouts) {
+        auto it = s_deviceObjectCache->__keys.find({ObjectType::DescriptorSetLayout, (uint64_t)setLayout});
+        venom_assert(it != s_deviceObjectCache->__keys.end(), "DeviceObjectCache::AcquirePipelineLayout() : set layout not from the cache");
+        if (it == s_deviceObjectCache->__keys.end())
+            continue;
+        ++s_deviceObjectCache->__objects.at(it->second).refCount;
+        dependencies.emplace_back((uint64_t)setLayout);
+    }
+    s_deviceObjectCache->__Insert(std::move(key), (uint64_t)layout, std::move(dependencies));
+    return layout;
+}
+
+void DeviceObjectCache::Release(VkSampler sampler)
+{
+    if (!s_deviceObjectCache || sampler == VK_NULL_HANDLE)
+        return;
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    s_deviceObjectCache->__Release(ObjectType::Sampler, (uint64_t)sampler);
+}
+
+void DeviceObjectCache::Release(VkDescriptorSetLayout layout)
+{
+    if (!s_deviceObjectCache || layout == VK_NULL_HANDLE)
+        return;
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    s_deviceObjectCache->__Release(ObjectType::DescriptorSetLayout, (uint64_t)layout);
+}
+
+void DeviceObjectCache::Release(VkPipelineLayout layout)
+{
+    if (!s_deviceObjectCache || layout == VK_NULL_HANDLE)
+        return;
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    s_deviceObjectCache->__Release(ObjectType::PipelineLayout, (uint64_t)layout);
+}
+
+size_t DeviceObjectCache::GetObjectCount()
+{
+    if (!s_deviceObjectCache)
+        return 0;
+    std::lock_guard<std::mutex> lock(s_deviceObjectCache->__mutex);
+    return s_deviceObjectCache->__objects.size();
+}
+
+DeviceObjectCache::Key DeviceObjectCache::__MakeKey(std::vector<uint64_t>&& words)
+{
+    Key key;
+    key.words = std::move(words);
+    // FNV-1a, byte by byte in a fixed order
+    key.hash = 14695981039346656037ull;
+    for (const uint64_t word : key.words) {
+        for (int i = 0; i < 8; ++i) {
+            key.hash ^= (word >> (i * 8)) & 0xff;
+            key.hash *= 1099511628211ull;
+        }
+    }
+    return key;
+}
+
+uint64_t DeviceObjectCache::__Find(const Key& key)
+{
+    auto it = __objects.find(key);
+    if (it == __objects.end())
+        return 0;
+    ++it->second.refCount;
+    return it->second.handle;
+}
+
+void DeviceObjectCache::__Insert(Key&& key, const uint64_t handle, std::vector<uint64_t>&& dependencies)
+{
+    const ObjectType type = static_cast<ObjectType>(key.words[0]);
+    __keys.emplace(std::make_pair(type, handle), key);
+    __objects.emplace(std::move(key), Entry{handle, 1, std::move(dependencies)});
+}
+
+void DeviceObjectCache::__Release(const ObjectType type, const uint64_t handle)
+{
+    auto keyIt = __keys.find({type, handle});
+    venom_assert(keyIt != __keys.end(), "DeviceObjectCache::Release() : handle not from the cache");
+    if (keyIt == __keys.end())
+        return;
+    auto it = __objects.find(keyIt->second);
+    if (--it->second.refCount > 0)
+        return;
+
+    const std::vector<uint64_t> dependencies = std::move(it->second.dependencies);
+    __objects.erase(it);
+    __keys.erase(keyIt);
+    __Destroy(type, handle, true);
+    for (const uint64_t dependency : dependencies)
+        __Release(ObjectType::DescriptorSetLayout, dependency);
+}
+
+void DeviceObjectCache::__Destroy(const ObjectType type, const uint64_t handle, const bool deferred)
+{
+    switch (type)
+    {
+    case ObjectType::Sampler:
+        if (deferred)
+            DeletionQueue::DestroySampler((VkSampler)handle);
+        else
+            vkDestroySampler(LogicalDevice::GetVkDevice(), (VkSampler)handle, Allocator::GetVKAllocationCallbacks());
+        break;
+    case ObjectType::DescriptorSetLayout:
+        if (deferred)
+            DeletionQueue::DestroyDescriptorSetLayout((VkDescriptorSetLayout)handle);
+        else
+            vkDestroyDescriptorSetLayout(LogicalDevice::GetVkDevice(), (VkDescriptorSetLayout)handle, Allocator::GetVKAllocationCallbacks());
+        break;
+    case ObjectType::PipelineLayout:
+        if (deferred)
+            DeletionQueue::DestroyPipelineLayout((VkPipelineLayout)handle);
+        else
+            vkDestroyPipelineLayout(LogicalDevice::GetVkDevice(), (VkPipelineLayout)handle, Allocator::GetVKAllocationCallbacks());
+        break;
+    }
+}
+}
+}
@@ -56,4 +56,25 @@ const VkFence * Fence::GetFence() const
 {
     return &__fence;
 }
+
+void Fence::Reset() const
+{
+    vkResetFences(LogicalDevice::GetVkDevice(), 1, &__fence);
+}
+
+vc::Error Fence::Wait(const uint64_t timeout) const
+{
+    if (VkResult res = vkWaitForFences(LogicalDevice::GetVkDevice(), 1, &__fence, VK_TRUE, timeout); res != VK_SUCCESS) {
+        if (res == VK_TIMEOUT)
+            return vc::Error::Failure;
+        vc::Log::Error("Failed to wait for fence: %d", res);
+        return res == VK_ERROR_DEVICE_LOST ? vc::Error::DeviceLost : vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+bool Fence::IsSignaled() const
+{
+    return vkGetFenceStatus(LogicalDevice::GetVkDevice(), __fence) == VK_SUCCESS;
+}
 }
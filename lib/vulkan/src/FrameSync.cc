@@ -0,0 +1,178 @@
+///
+/// Project: VenomEngine
+/// @file FrameSync.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/FrameSync.h>
+#include <venom/vulkan/CommandPool.h>
+
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static FrameSync * s_frameSync = nullptr;
+
+FrameSync::FrameSync()
+    : __framesInFlight(0)
+    , __presentable(true)
+    , __lastSubmittedValue(0)
+    , __lastCompletedValue(0)
+{
+    s_frameSync = this;
+}
+
+FrameSync::~FrameSync()
+{
+    Destroy();
+    s_frameSync = nullptr;
+}
+
+vc::Error FrameSync::Init(const uint32_t framesInFlight, const bool presentable)
+{
+    vc::Error err;
+    __framesInFlight = framesInFlight;
+    __presentable = presentable;
+    __lastSubmittedValue.store(0, std::memory_order_release);
+    __lastCompletedValue = 0;
+    if (err = __timeline.InitTimelineSemaphore(0); err != vc::Error::Success)
+        return err;
+
+    if (!presentable)
+        return vc::Error::Success;
+
+    __imageAvailableSemaphores.resize(framesInFlight);
+    __renderFinishedSemaphores.resize(framesInFlight);
+    for (uint32_t i = 0; i < framesInFlight; ++i) {
+        if (err = __imageAvailableSemaphores[i].InitSemaphore(); err != vc::Error::Success)
+            return err;
+        if (err = __renderFinishedSemaphores[i].InitSemaphore(); err != vc::Error::Success)
+            return err;
+    }
+    return vc::Error::Success;
+}
+
+void FrameSync::Destroy()
+{
+    const FrameValue lastSubmittedValue = __lastSubmittedValue.load(std::memory_order_acquire);
+    if (__timeline.GetSemaphore() != VK_NULL_HANDLE && lastSubmittedValue > 0)
+        __timeline.Wait(lastSubmittedValue);
+    __imageAvailableSemaphores.clear();
+    __renderFinishedSemaphores.clear();
+    __timeline.DestroySemaphore();
+}
+
+vc::Error FrameSync::BeginFrame(const uint64_t timeout)
+{
+    // The slot we're about to use was last used framesInFlight frames ago
+    const FrameValue currentValue = __lastSubmittedValue.load(std::memory_order_acquire) + 1;
+    if (currentValue <= __framesInFlight)
+        return vc::Error::Success;
+    return WaitForFrame(currentValue - __framesInFlight, timeout);
+}
+
+vc::Error FrameSync::SubmitFrame(const Queue& queue, const CommandBuffer* commandBuffer, const VkPipelineStageFlags waitStage,
+    const VkSemaphore uploadSemaphore, const uint64_t uploadValue)
+{
+    const FrameValue signalValue = __lastSubmittedValue.load(std::memory_order_acquire) + 1;
+    const VkCommandBuffer vkCommandBuffer = commandBuffer->GetVkCommandBuffer();
+    // The acquired image (binary, ignores its value), then the uploads
+    VkSemaphore waitSemaphores[2];
+    VkPipelineStageFlags waitStages[2];
+    uint64_t waitValues[2];
+    uint32_t waitCount = 0;
+    if (__presentable) {
+        waitSemaphores[waitCount] = GetImageAvailableSemaphore();
+        waitStages[waitCount] = waitStage;
+        waitValues[waitCount++] = 0;
+    }
+    if (uploadSemaphore != VK_NULL_HANDLE && uploadValue > 0) {
+        waitSemaphores[waitCount] = uploadSemaphore;
+        waitStages[waitCount] = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        waitValues[waitCount++] = uploadValue;
+    }
+    // Timeline last so that headless submissions only signal it
+    const VkSemaphore signalSemaphores[] = {__presentable ? GetRenderFinishedSemaphore() : VK_NULL_HANDLE, __timeline.GetSemaphore()};
+    // Binary semaphores ignore their value
+    const uint64_t signalValues[] = {0, signalValue};
+    const uint32_t binaryCount = __presentable ? 1 : 0;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = waitCount;
+    timelineInfo.pWaitSemaphoreValues = waitValues;
+    timelineInfo.signalSemaphoreValueCount = 1 + binaryCount;
+    timelineInfo.pSignalSemaphoreValues = signalValues + 1 - binaryCount;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.waitSemaphoreCount = waitCount;
+    submitInfo.pWaitSemaphores = waitSemaphores;
+    submitInfo.pWaitDstStageMask = waitStages;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &vkCommandBuffer;
+    submitInfo.signalSemaphoreCount = 1 + binaryCount;
+    submitInfo.pSignalSemaphores = signalSemaphores + 1 - binaryCount;
+
+    if (VkResult res = vkQueueSubmit(queue.GetVkQueue(), 1, &submitInfo, VK_NULL_HANDLE); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to submit frame %" PRIu64 ": %d", signalValue, res);
+        return res == VK_ERROR_DEVICE_LOST ? vc::Error::DeviceLost : vc::Error::Failure;
+    }
+    __lastSubmittedValue.store(signalValue, std::memory_order_release);
+    return vc::Error::Success;
+}
+
+VkSemaphore FrameSync::GetImageAvailableSemaphore() const
+{
+    return __imageAvailableSemaphores[GetFrameIndex()].GetSemaphore();
+}
+
+VkSemaphore FrameSync::GetRenderFinishedSemaphore() const
+{
+    return __renderFinishedSemaphores[GetFrameIndex()].GetSemaphore();
+}
+
+uint32_t FrameSync::GetFrameIndex()
+{
+    venom_assert(s_frameSync, "FrameSync not created");
+    return static_cast<uint32_t>(s_frameSync->__lastSubmittedValue.load(std::memory_order_acquire) % s_frameSync->__framesInFlight);
+}
+
+FrameValue FrameSync::GetCurrentFrameValue()
+{
+    venom_assert(s_frameSync, "FrameSync not created");
+    return s_frameSync->__lastSubmittedValue.load(std::memory_order_acquire) + 1;
+}
+
+FrameValue FrameSync::GetCompletedFrameValue()
+{
+    venom_assert(s_frameSync, "FrameSync not created");
+    const FrameValue value = s_frameSync->__timeline.GetCounterValue();
+    s_frameSync->__lastCompletedValue = value;
+    return value;
+}
+
+bool FrameSync::IsFrameComplete(const FrameValue value)
+{
+    venom_assert(s_frameSync, "FrameSync not created");
+    if (value <= s_frameSync->__lastCompletedValue)
+        return true;
+    return value <= GetCompletedFrameValue();
+}
+
+vc::Error FrameSync::WaitForFrame(const FrameValue value, const uint64_t timeout)
+{
+    if (IsFrameComplete(value))
+        return vc::Error::Success;
+    if (vc::Error err = s_frameSync->__timeline.Wait(value, timeout); err != vc::Error::Success)
+        return err;
+    if (s_frameSync->__lastCompletedValue < value)
+        s_frameSync->__lastCompletedValue = value;
+    return vc::Error::Success;
+}
+}
+}
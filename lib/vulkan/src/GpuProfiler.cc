@@ -0,0 +1,246 @@
+///
+/// Project: VenomEngine
+/// @file GpuProfiler.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/GpuProfiler.h>
+#include <venom/vulkan/CommandPool.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PhysicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace venom
+{
+namespace vulkan
+{
+static GpuProfiler * s_gpuProfiler = nullptr;
+
+GpuProfiler::GpuProfiler()
+    : __queryPool(VK_NULL_HANDLE)
+    , __currentFrame(nullptr)
+    , __frameScope(INVALID_GPU_SCOPE)
+    , __maxScopesPerFrame(0)
+    , __timestampPeriod(0.0)
+    , __timestampMask(0)
+{
+    s_gpuProfiler = this;
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    Destroy();
+    s_gpuProfiler = nullptr;
+}
+
+vc::Error GpuProfiler::Init(const uint32_t framesInFlight, const Queue& queue, const uint32_t maxScopesPerFrame)
+{
+    const VkPhysicalDevice physicalDevice = PhysicalDevice::GetUsedPhysicalDevice().GetVkPhysicalDevice();
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+    const uint32_t validBits = queueFamilies[queue.GetQueueFamilyIndex()].timestampValidBits;
+    if (validBits == 0) {
+        vc::Log::Print("Timestamps not supported by the graphics queue, GPU profiling disabled");
+        return vc::Error::Success;
+    }
+    __timestampMask = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+    __timestampPeriod = PhysicalDevice::GetUsedPhysicalDevice().GetProperties().limits.timestampPeriod;
+    __maxScopesPerFrame = maxScopesPerFrame;
+
+    VkQueryPoolCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    // Begin & end timestamp per scope
+    createInfo.queryCount = framesInFlight * maxScopesPerFrame * 2;
+    if (VkResult res = vkCreateQueryPool(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__queryPool); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create timestamp query pool: %d", res);
+        return vc::Error::Failure;
+    }
+
+    __frames.clear();
+    for (uint32_t i = 0; i < framesInFlight; ++i) {
+        auto frame = std::make_unique<FrameQueries>();
+        frame->firstQuery = i * maxScopesPerFrame * 2;
+        frame->names.resize(maxScopesPerFrame, nullptr);
+        __frames.emplace_back(std::move(frame));
+    }
+    // Result & availability per query
+    __results.resize(maxScopesPerFrame * 2 * 2);
+    return vc::Error::Success;
+}
+
+void GpuProfiler::Destroy()
+{
+    if (__queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(LogicalDevice::GetVkDevice(), __queryPool, Allocator::GetVKAllocationCallbacks());
+        __queryPool = VK_NULL_HANDLE;
+    }
+    __frames.clear();
+    __currentFrame = nullptr;
+}
+
+void GpuProfiler::BeginFrame(const CommandBuffer* commandBuffer)
+{
+    if (!IsEnabled())
+        return;
+    FrameQueries & frame = *s_gpuProfiler->__frames[FrameSync::GetFrameIndex()];
+    // FrameSync::BeginFrame() already waited for it, it can only be incomplete if its submission failed
+    if (frame.frame != 0 && FrameSync::IsFrameComplete(frame.frame))
+        s_gpuProfiler->__Collect(frame);
+
+    vkCmdResetQueryPool(commandBuffer->GetVkCommandBuffer(), s_gpuProfiler->__queryPool, frame.firstQuery, s_gpuProfiler->__maxScopesPerFrame * 2);
+    frame.frame = FrameSync::GetCurrentFrameValue();
+    frame.scopeCount = 0;
+    s_gpuProfiler->__currentFrame = &frame;
+    s_gpuProfiler->__frameScope = BeginScope(commandBuffer, "Frame");
+}
+
+void GpuProfiler::EndFrame(const CommandBuffer* commandBuffer)
+{
+    if (!IsEnabled())
+        return;
+    EndScope(commandBuffer, s_gpuProfiler->__frameScope);
+    s_gpuProfiler->__frameScope = INVALID_GPU_SCOPE;
+    s_gpuProfiler->__currentFrame = nullptr;
+}
+
+GpuScopeId GpuProfiler::BeginScope(const CommandBuffer* commandBuffer, const char* name)
+{
+    if (!IsEnabled() || !s_gpuProfiler->__currentFrame)
+        return INVALID_GPU_SCOPE;
+    FrameQueries & frame = *s_gpuProfiler->__currentFrame;
+    const uint32_t scope = frame.scopeCount.fetch_add(1, std::memory_order_relaxed);
+    if (scope >= s_gpuProfiler->__maxScopesPerFrame)
+        return INVALID_GPU_SCOPE;
+    frame.names[scope] = name;
+    vkCmdWriteTimestamp(commandBuffer->GetVkCommandBuffer(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, s_gpuProfiler->__queryPool, frame.firstQuery + scope * 2);
+    return scope;
+}
+
+void GpuProfiler::EndScope(const CommandBuffer* commandBuffer, const GpuScopeId scope)
+{
+    if (scope == INVALID_GPU_SCOPE || !IsEnabled() || !s_gpuProfiler->__currentFrame)
+        return;
+    const FrameQueries & frame = *s_gpuProfiler->__currentFrame;
+    vkCmdWriteTimestamp(commandBuffer->GetVkCommandBuffer(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, s_gpuProfiler->__queryPool, frame.firstQuery + scope * 2 + 1);
+}
+
+bool GpuProfiler::IsEnabled()
+{
+    return s_gpuProfiler && s_gpuProfiler->__queryPool != VK_NULL_HANDLE;
+}
+
+std::vector<GpuScopeStats> GpuProfiler::GetStats()
+{
+    std::vector<GpuScopeStats> stats;
+    if (!s_gpuProfiler)
+        return stats;
+    stats.reserve(s_gpuProfiler->__history.size());
+    for (const auto & [name, history] : s_gpuProfiler->__history)
+        stats.emplace_back(__ComputeStats(name, history));
+    return stats;
+}
+
+void GpuProfiler::LogStats()
+{
+    const std::vector<GpuScopeStats> stats = GetStats();
+    if (stats.empty())
+        return;
+    vc::Log::Print("%-24s %10s %10s %10s %10s", "GPU scope (ms)", "last", "avg", "min", "max");
+    for (const GpuScopeStats & scope : stats)
+        vc::Log::Print("%-24s %10.3f %10.3f %10.3f %10.3f", scope.name.c_str(), scope.last, scope.average, scope.min, scope.max);
+}
+
+vc::Error GpuProfiler::WriteJSON(const char* path)
+{
+    FILE * file = fopen(path, "w");
+    if (!file) {
+        vc::Log::Error("Failed to open %s", path);
+        return vc::Error::Failure;
+    }
+    const std::vector<GpuScopeStats> stats = GetStats();
+    fprintf(file, "{\n  \"gpu_scopes_ms\": {\n");
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const GpuScopeStats & scope = stats[i];
+        fprintf(file, "    \"%s\": {\"last\": %.4f, \"avg\": %.4f, \"min\": %.4f, \"max\": %.4f, \"samples\": %" PRIu64 "}%s\n",
+            scope.name.c_str(), scope.last, scope.average, scope.min, scope.max, scope.sampleCount, i + 1 < stats.size() ? "," : "");
+    }
+    fprintf(file, "  }\n}\n");
+    fclose(file);
+    return vc::Error::Success;
+}
+
+void GpuProfiler::__Collect(FrameQueries& frame)
+{
+    const uint32_t scopeCount = std::min(frame.scopeCount.load(), __maxScopesPerFrame);
+    frame.frame = 0;
+    if (scopeCount == 0)
+        return;
+
+    // No WAIT_BIT: the frame is complete, unwritten queries (scope never ended) are just unavailable
+    const uint32_t queryCount = scopeCount * 2;
+    const VkResult res = vkGetQueryPoolResults(LogicalDevice::GetVkDevice(), __queryPool, frame.firstQuery, queryCount,
+        queryCount * 2 * sizeof(uint64_t), __results.data(), 2 * sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    if (res != VK_SUCCESS && res != VK_NOT_READY)
+        return;
+
+    // Scopes appearing several times in the frame (e.g. one per draw batch) are summed
+    __frameTotals.clear();
+    for (uint32_t scope = 0; scope < scopeCount; ++scope) {
+        const uint64_t * begin = &__results[scope * 4];
+        const uint64_t * end = begin + 2;
+        if (begin[1] == 0 || end[1] == 0 || !frame.names[scope])
+            continue;
+        const uint64_t ticks = (end[0] - begin[0]) & __timestampMask;
+        const double milliseconds = static_cast<double>(ticks) * __timestampPeriod / 1'000'000.0;
+        auto total = std::find_if(__frameTotals.begin(), __frameTotals.end(), [&](const auto & t) {
+            return strcmp(t.first, frame.names[scope]) == 0;
+        });
+        if (total == __frameTotals.end())
+            __frameTotals.emplace_back(frame.names[scope], milliseconds);
+        else
+            total->second += milliseconds;
+    }
+
+    for (const auto & [name, milliseconds] : __frameTotals) {
+        auto it = __history.find(std::string_view(name));
+        if (it == __history.end())
+            it = __history.emplace(name, ScopeHistory{}).first;
+        ScopeHistory & history = it->second;
+        if (history.samples.size() < ROLLING_WINDOW)
+            history.samples.emplace_back(milliseconds);
+        else
+            history.samples[history.next] = milliseconds;
+        history.next = (history.next + 1) % ROLLING_WINDOW;
+        history.last = milliseconds;
+        ++history.sampleCount;
+    }
+}
+
+GpuScopeStats GpuProfiler::__ComputeStats(const std::string& name, const ScopeHistory& history)
+{
+    GpuScopeStats stats{};
+    stats.name = name;
+    stats.last = history.last;
+    stats.sampleCount = history.sampleCount;
+    if (history.samples.empty())
+        return stats;
+    stats.min = *std::min_element(history.samples.begin(), history.samples.end());
+    stats.max = *std::max_element(history.samples.begin(), history.samples.end());
+    double sum = 0.0;
+    for (const double sample : history.samples)
+        sum += sample;
+    stats.average = sum / history.samples.size();
+    return stats;
+}
+}
+}
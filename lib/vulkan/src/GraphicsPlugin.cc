@@ -8,6 +8,7 @@
 #include <venom/vulkan/plugin/graphics/GraphicsPlugin.h>
 
 #include <venom/vulkan/VulkanApplication.h>
+#include <venom/vulkan/DeletionQueue.h>
 #include <venom/vulkan/plugin/graphics/Model.h>
 #include <venom/vulkan/plugin/graphics/Mesh.h>
 #include <venom/vulkan/plugin/graphics/Material.h>
@@ -41,6 +42,14 @@ vc::Material* VulkanGraphicsPlugin::CreateMaterial()
 {
     return new VulkanMaterial();
 }
+
+void VulkanGraphicsPlugin::CleanPluginObjects()
+{
+    // Removed objects push their Vulkan handles to the deletion queue
+    vc::GraphicsPlugin::CleanPluginObjects();
+    // Then everything the GPU is done with gets destroyed
+    DeletionQueue::Update();
+}
 }
 }
 
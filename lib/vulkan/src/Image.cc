@@ -11,6 +11,8 @@
 #include <venom/vulkan/QueueManager.h>
 #include <venom/vulkan/Buffer.h>
 #include <venom/vulkan/CommandPoolManager.h>
+#include <venom/vulkan/UploadManager.h>
+#include <venom/vulkan/DeletionQueue.h>
 
 namespace venom
 {
@@ -18,7 +20,7 @@ namespace vulkan
 {
 Image::Image()
     : __image(VK_NULL_HANDLE)
-    , __imageMemory(VK_NULL_HANDLE)
+    , __allocation()
     , __width(0), __height(0)
     , __layout(VK_IMAGE_LAYOUT_UNDEFINED)
 {
@@ -26,29 +28,28 @@ Image::Image()
 
 Image::~Image()
 {
-    if (__image != VK_NULL_HANDLE)
-        vkDestroyImage(LogicalDevice::GetVkDevice(), __image, Allocator::GetVKAllocationCallbacks());
-    if (__imageMemory != VK_NULL_HANDLE)
-        vkFreeMemory(LogicalDevice::GetVkDevice(), __imageMemory, Allocator::GetVKAllocationCallbacks());
+    // Frames in flight may still sample it
+    if (__image != VK_NULL_HANDLE || __allocation.IsValid())
+        DeletionQueue::DestroyImage(__image, &__allocation);
 }
 
 Image::Image(Image&& image) noexcept
     : __image(image.__image)
-    , __imageMemory(image.__imageMemory)
+    , __allocation(image.__allocation)
     , __width(image.__width), __height(image.__height)
     , __layout(image.__layout)
 {
     image.__image = VK_NULL_HANDLE;
-    image.__imageMemory = VK_NULL_HANDLE;
+    image.__allocation = DeviceMemoryAllocation{};
 }
 
 Image& Image::operator=(Image&& image) noexcept
 {
     if (this != &image) {
         __image = image.__image;
-        __imageMemory = image.__imageMemory;
+        __allocation = image.__allocation;
         image.__image = VK_NULL_HANDLE;
-        image.__imageMemory = VK_NULL_HANDLE;
+        image.__allocation = DeviceMemoryAllocation{};
         __width = image.__width;
         __height = image.__height;
         __layout = image.__layout;
@@ -56,29 +57,14 @@ Image& Image::operator=(Image&& image) noexcept
     return *this;
 }
 
-vc::Error Image::Load(unsigned char* pixels, int width, int height, int channels,
+vc::Error Image::Load(const unsigned char* pixels, int width, int height, int channels,
     VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties)
 {
-    // Buffer
-    Buffer stagingBuffer;
-    vc::Error err = stagingBuffer.CreateBuffer(width * height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        QueueManager::GetGraphicsComputeTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    if (err != vc::Error::Success)
+    if (vc::Error err = Create(format, tiling, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, properties, width, height); err != vc::Error::Success)
         return err;
-    stagingBuffer.WriteBuffer(pixels);
-
-    if (err = Create(format, tiling, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, properties, width, height); err != vc::Error::Success)
-        return err;
-
-    SingleTimeCommandBuffer commandBuffer;
-    if (err = CommandPoolManager::GetGraphicsCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer); err != vc::Error::Success)
-        return err;
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    commandBuffer.CopyBufferToImage(stagingBuffer, *this);
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-    __layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    return vc::Error::Success;
+    // Recorded in the current upload batch, frames sampling the image wait on it on the GPU
+    UploadHandle uploadHandle;
+    return UploadManager::UploadImage(pixels, static_cast<VkDeviceSize>(width) * height * 4, *this, format, &uploadHandle);
 }
 
 vc::Error Image::Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
@@ -112,17 +98,17 @@ vc::Error Image::Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements(LogicalDevice::GetVkDevice(), __image, &memRequirements);
 
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = Buffer::FindMemoryType(memRequirements.memoryTypeBits, properties);
+    // Render targets get their own memory, drivers can apply compression/placement optimizations to them
+    const bool dedicated = usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    if (vc::Error err = DeviceMemoryAllocator::Allocate(memRequirements, properties, dedicated, &__allocation); err != vc::Error::Success) {
+        vc::Log::Error("Failed to allocate image memory");
+        return err;
+    }
 
-    if (VkResult vkErr = vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &__imageMemory); vkErr != VK_SUCCESS) {
-        vc::Log::Error("Failed to allocate image memory: %d", vkErr);
+    if (VkResult vkErr = vkBindImageMemory(LogicalDevice::GetVkDevice(), __image, __allocation.memory, __allocation.offset); vkErr != VK_SUCCESS) {
+        vc::Log::Error("Failed to bind image memory: %d", vkErr);
         return vc::Error::Failure;
     }
-
-    vkBindImageMemory(LogicalDevice::GetVkDevice(), __image, __imageMemory, 0);
     __width  = static_cast<uint32_t>(width);
     __height = static_cast<uint32_t>(height);
     return vc::Error::Success;
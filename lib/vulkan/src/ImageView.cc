@@ -9,6 +9,7 @@
 
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DeletionQueue.h>
 
 namespace venom
 {
@@ -22,7 +23,7 @@ ImageView::ImageView()
 ImageView::~ImageView()
 {
     if (__imageView != VK_NULL_HANDLE)
-        vkDestroyImageView(LogicalDevice::GetVkDevice(), __imageView, Allocator::GetVKAllocationCallbacks());
+        DeletionQueue::DestroyImageView(__imageView);
 }
 
 ImageView::ImageView(ImageView&& other)
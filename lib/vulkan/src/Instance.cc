@@ -8,6 +8,8 @@
 #include <venom/vulkan/Instance.h>
 #include <venom/vulkan/Allocator.h>
 
+#include <venom/common/Config.h>
+
 #include <memory>
 
 namespace venom::vulkan
@@ -32,9 +34,12 @@ void Instance::__Instance_GetRequiredExtensions(VkInstanceCreateInfo* createInfo
 {
     // We are only using GLFW anyway for Windows, Linux & MacOS and next to Vulkan will only be Metal
     // DX12 will be for another standalone project
-    uint32_t glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-    __instanceExtensions = std::vector<const char *>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    // Headless: no window, no surface extensions (GLFW isn't even initialized)
+    if (!vc::Config::GetInstance()->IsHeadless()) {
+        uint32_t glfwExtensionCount = 0;
+        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+        __instanceExtensions = std::vector<const char *>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    }
 
 #ifdef __APPLE__
     // Might have a bug with MoltenVK
@@ -93,7 +98,7 @@ vc::Error Instance::CreateInstance(Instance * instance)
     appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.pEngineName = "VenomEngine";
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-    appInfo.apiVersion = VK_API_VERSION_1_0;
+    appInfo.apiVersion = VK_API_VERSION_1_2;
 
     VkInstanceCreateInfo createInfo = {};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -10,11 +10,14 @@
 
 #include "venom/vulkan/QueueManager.h"
 
+#include <algorithm>
+
 namespace venom
 {
 namespace vulkan
 {
 VulkanMesh::VulkanMesh()
+    : __uploadHandle(0)
 {
 }
 
@@ -27,28 +30,15 @@ void VulkanMesh::Draw()
     common::Log::Print("Mesh draw");
 }
 
-vc::Error VulkanMesh::__LoadMeshFromCurrentData()
+vc::Error VulkanMesh::__LoadMeshFromStreams(const vc::MeshStreams & streams)
 {
-    // Positions
-    if (!__positions.empty() && AddVertexBuffer(__positions.data(), static_cast<uint32_t>(__positions.size()), sizeof(vcm::VertexPos), 0) != vc::Error::Success)
-        return vc::Error::Failure;
-    // Normals
-    if (!__normals.empty() && AddVertexBuffer(__normals.data(), static_cast<uint32_t>(__normals.size()), sizeof(vcm::VertexNormal), 1) != vc::Error::Success)
-        return vc::Error::Failure;
-    // Colors
-    if (!__colors[0].empty() && AddVertexBuffer(__colors[0].data(), static_cast<uint32_t>(__colors[0].size()), sizeof(vcm::VertexColor), 2) != vc::Error::Success)
-        return vc::Error::Failure;
-    // UVs
-    if (!__uvs[0].empty() && AddVertexBuffer(__uvs[0].data(), static_cast<uint32_t>(__uvs[0].size()), sizeof(vcm::VertexUV), 3) != vc::Error::Success)
-        return vc::Error::Failure;
-    // Tangents
-    if (!__tangents.empty() && AddVertexBuffer(__tangents.data(), static_cast<uint32_t>(__tangents.size()), sizeof(vcm::VertexTangent), 4) != vc::Error::Success)
-        return vc::Error::Failure;
-    // Bitangents
-    if (!__bitangents.empty() && AddVertexBuffer(__bitangents.data(), static_cast<uint32_t>(__bitangents.size()), sizeof(vcm::VertexBitangent), 5) != vc::Error::Success)
-        return vc::Error::Failure;
+    // Positions, Normals, Colors, UVs, Tangents, Bitangents, bound in stream order
+    for (uint32_t stream = 0; stream < static_cast<uint32_t>(vc::VertexStream::Count); ++stream) {
+        if (streams.streams[stream] && AddVertexBuffer(streams.streams[stream], streams.vertexCount, vc::VERTEX_STREAM_STRIDES[stream], static_cast<int>(stream)) != vc::Error::Success)
+            return vc::Error::Failure;
+    }
     // Indices
-    if (!__indices.empty() && AddIndexBuffer(__indices.data(), static_cast<uint32_t>(__indices.size()), sizeof(uint32_t)) != vc::Error::Success)
+    if (streams.indices && AddIndexBuffer(streams.indices, streams.indexCount, sizeof(uint32_t)) != vc::Error::Success)
         return vc::Error::Failure;
     return vc::Error::Success;
 }
@@ -60,6 +50,7 @@ vc::Error VulkanMesh::AddVertexBuffer(const void* data, const uint32_t vertexCou
         return vc::Error::Failure;
     __vkVertexBuffers.emplace_back(binding, newVertexBuffer.GetVkBuffer());
     __offsets.emplace_back(0);
+    __uploadHandle = std::max(__uploadHandle, newVertexBuffer.GetUploadHandle());
     return vc::Error::Success;
 }
 
@@ -67,6 +58,10 @@ vc::Error VulkanMesh::AddIndexBuffer(const void* data, const uint32_t indexCount
 {
     if (__indexBuffer.Init(indexCount, indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, data) != vc::Error::Success)
         return vc::Error::Failure;
+    // Built by hand, without LODs: drawn whole
+    if (__lods.empty())
+        __lods.assign(1, vc::MeshLod{0, indexCount, 0.0f});
+    __uploadHandle = std::max(__uploadHandle, __indexBuffer.GetUploadHandle());
     return vc::Error::Success;
 }
 
@@ -100,5 +95,15 @@ VkDeviceSize* VulkanMesh::GetOffsets() const
 {
     return const_cast<VkDeviceSize*>(__offsets.data());
 }
+
+UploadHandle VulkanMesh::GetUploadHandle() const
+{
+    return __uploadHandle;
+}
+
+bool VulkanMesh::IsReady() const
+{
+    return UploadManager::IsSubmitted(__uploadHandle);
+}
 }
 }
@@ -0,0 +1,149 @@
+///
+/// Project: VenomEngine
+/// @file PipelineCache.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/PipelineCache.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PhysicalDevice.h>
+#include <venom/vulkan/Allocator.h>
+
+#include <venom/common/Trace.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace venom
+{
+namespace vulkan
+{
+static PipelineCache * s_pipelineCache = nullptr;
+
+PipelineCache::PipelineCache()
+    : __cache(VK_NULL_HANDLE)
+{
+    s_pipelineCache = this;
+}
+
+PipelineCache::~PipelineCache()
+{
+    if (__cache != VK_NULL_HANDLE)
+        Save();
+    Destroy();
+    s_pipelineCache = nullptr;
+}
+
+vc::Error PipelineCache::Init(const std::string& directory)
+{
+    VENOM_TRACE_FUNCTION();
+    std::vector<char> data;
+    if (!directory.empty()) {
+        const VkPhysicalDeviceProperties & properties = PhysicalDevice::GetUsedPhysicalDevice().GetProperties();
+        char uuid[VK_UUID_SIZE * 2 + 1];
+        for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+            snprintf(uuid + i * 2, 3, "%02x", properties.pipelineCacheUUID[i]);
+        char fileName[128];
+        snprintf(fileName, sizeof(fileName), "pipeline_cache_%04x_%04x_%08x_%s.bin",
+            properties.vendorID, properties.deviceID, properties.driverVersion, uuid);
+        __path = (std::filesystem::path(directory) / fileName).string();
+
+        std::ifstream file(__path, std::ios::ate | std::ios::binary);
+        if (file.is_open()) {
+            data.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(data.data(), data.size());
+            if (!file || !__IsCompatible(data)) {
+                vc::Log::Print("Ignoring invalid pipeline cache: %s", __path.c_str());
+                data.clear();
+            }
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = data.size();
+    createInfo.pInitialData = data.empty() ? nullptr : data.data();
+    VkResult res = vkCreatePipelineCache(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__cache);
+    if (res != VK_SUCCESS && !data.empty()) {
+        // The driver may still refuse data that passed the header check
+        vc::Log::Print("Pipeline cache rejected by the driver (%d), starting from an empty one", res);
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        res = vkCreatePipelineCache(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__cache);
+    }
+    if (res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create pipeline cache: %d", res);
+        return vc::Error::InitializationFailed;
+    }
+    if (!data.empty())
+        vc::Log::Print("Loaded pipeline cache: %s (%zu bytes)", __path.c_str(), data.size());
+    return vc::Error::Success;
+}
+
+vc::Error PipelineCache::Save() const
+{
+    if (__cache == VK_NULL_HANDLE || __path.empty())
+        return vc::Error::Success;
+
+    size_t size = 0;
+    if (VkResult res = vkGetPipelineCacheData(LogicalDevice::GetVkDevice(), __cache, &size, nullptr); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to get pipeline cache size: %d", res);
+        return vc::Error::Failure;
+    }
+    std::vector<char> data(size);
+    if (VkResult res = vkGetPipelineCacheData(LogicalDevice::GetVkDevice(), __cache, &size, data.data()); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to get pipeline cache data: %d", res);
+        return vc::Error::Failure;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(__path).parent_path(), ec);
+    const std::string tmpPath = __path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open() || !file.write(data.data(), size)) {
+            vc::Log::Error("Failed to write pipeline cache: %s", tmpPath.c_str());
+            return vc::Error::Failure;
+        }
+    }
+    std::filesystem::rename(tmpPath, __path, ec);
+    if (ec) {
+        vc::Log::Error("Failed to write pipeline cache: %s (%s)", __path.c_str(), ec.message().c_str());
+        std::filesystem::remove(tmpPath, ec);
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+void PipelineCache::Destroy()
+{
+    if (__cache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(LogicalDevice::GetVkDevice(), __cache, Allocator::GetVKAllocationCallbacks());
+        __cache = VK_NULL_HANDLE;
+    }
+}
+
+VkPipelineCache PipelineCache::GetVkPipelineCache()
+{
+    return s_pipelineCache ? s_pipelineCache->__cache : VK_NULL_HANDLE;
+}
+
+bool PipelineCache::__IsCompatible(const std::vector<char>& data) const
+{
+    // The file name already matches, this catches truncated or hand-copied files
+    VkPipelineCacheHeaderVersionOne header;
+    if (data.size() < sizeof(header))
+        return false;
+    memcpy(&header, data.data(), sizeof(header));
+    const VkPhysicalDeviceProperties & properties = PhysicalDevice::GetUsedPhysicalDevice().GetProperties();
+    return header.headerSize >= sizeof(header)
+        && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && header.vendorID == properties.vendorID
+        && header.deviceID == properties.deviceID
+        && memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+}
+}
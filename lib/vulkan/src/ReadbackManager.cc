@@ -0,0 +1,246 @@
+///
+/// Project: VenomEngine
+/// @file ReadbackManager.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/ReadbackManager.h>
+#include <venom/vulkan/CommandPool.h>
+#include <venom/vulkan/PhysicalDevice.h>
+
+#include <venom/common/Config.h>
+#include <venom/common/ImageWriter.h>
+#include <venom/common/ThreadPool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static ReadbackManager * s_readbackManager = nullptr;
+
+/// @brief Offscreen images are RGBA8
+static constexpr uint32_t READBACK_CHANNELS = 4;
+
+ReadbackManager::ReadbackManager()
+    : __width(0)
+    , __height(0)
+    , __maxSlots(0)
+    , __memoryProperties(0)
+{
+    s_readbackManager = this;
+}
+
+ReadbackManager::~ReadbackManager()
+{
+    Destroy();
+    s_readbackManager = nullptr;
+}
+
+vc::Error ReadbackManager::Init(const uint32_t width, const uint32_t height, const uint32_t maxSlots)
+{
+    __width = width;
+    __height = height;
+    __maxSlots = std::max<uint32_t>(maxSlots, 1);
+
+    // Cached memory makes CPU reads way faster, coherent spares us the invalidation
+    __memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    const VkPhysicalDeviceMemoryProperties & memProperties = PhysicalDevice::GetUsedPhysicalDevice().GetMemoryProperties();
+    for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i) {
+        const VkMemoryPropertyFlags cached = __memoryProperties | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        if ((memProperties.memoryTypes[i].propertyFlags & cached) == cached) {
+            __memoryProperties = cached;
+            break;
+        }
+    }
+    return vc::Error::Success;
+}
+
+void ReadbackManager::Destroy()
+{
+    Flush();
+    __slots.clear();
+}
+
+vc::Error ReadbackManager::RecordReadback(CommandBuffer* commandBuffer, const Image& image)
+{
+    venom_assert(s_readbackManager, "ReadbackManager not created");
+    venom_assert(image.GetWidth() == s_readbackManager->__width && image.GetHeight() == s_readbackManager->__height, "ReadbackManager::RecordReadback() : image size mismatch");
+    Slot * slot = nullptr;
+    if (vc::Error err = s_readbackManager->__AcquireSlot(&slot); err != vc::Error::Success)
+        return err;
+
+    const VkImageSubresourceRange subresourceRange {
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel = 0,
+        .levelCount = 1,
+        .baseArrayLayer = 0,
+        .layerCount = 1
+    };
+    // Render pass already transitioned the image, only make its writes visible to the copy
+    const VkImageMemoryBarrier imageBarrier {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image.GetVkImage(),
+        .subresourceRange = subresourceRange
+    };
+    vkCmdPipelineBarrier(commandBuffer->GetVkCommandBuffer(), VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+    commandBuffer->CopyImageToBuffer(image, slot->buffer);
+
+    // Host reads are only safe once the timeline says so, this makes the copy's writes available to them
+    const VkBufferMemoryBarrier bufferBarrier {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .buffer = slot->buffer.GetVkBuffer(),
+        .offset = 0,
+        .size = VK_WHOLE_SIZE
+    };
+    vkCmdPipelineBarrier(commandBuffer->GetVkCommandBuffer(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+        0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+    slot->frame = FrameSync::GetCurrentFrameValue();
+    return vc::Error::Success;
+}
+
+void ReadbackManager::Update()
+{
+    if (!s_readbackManager)
+        return;
+    for (auto & slot : s_readbackManager->__slots) {
+        if (slot->frame != 0 && FrameSync::IsFrameComplete(slot->frame))
+            s_readbackManager->__Dispatch(*slot);
+    }
+}
+
+void ReadbackManager::Flush()
+{
+    if (!s_readbackManager)
+        return;
+    for (auto & slot : s_readbackManager->__slots) {
+        if (slot->frame != 0) {
+            FrameSync::WaitForFrame(slot->frame);
+            s_readbackManager->__Dispatch(*slot);
+        }
+    }
+    for (auto & slot : s_readbackManager->__slots) {
+        if (slot->job.valid())
+            slot->job.get();
+    }
+}
+
+void ReadbackManager::SetCallback(const ReadbackCallback& callback)
+{
+    venom_assert(s_readbackManager, "ReadbackManager not created");
+    s_readbackManager->__callback = callback;
+}
+
+bool ReadbackManager::IsEnabled()
+{
+    if (!s_readbackManager)
+        return false;
+    return s_readbackManager->__callback || vc::Config::GetInstance()->GetReadbackFormat() != vc::Config::ReadbackFormat::None;
+}
+
+bool ReadbackManager::__IsFree(Slot& slot)
+{
+    if (slot.frame != 0)
+        return false;
+    if (!slot.job.valid())
+        return true;
+    if (slot.job.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+    slot.job.get();
+    return true;
+}
+
+vc::Error ReadbackManager::__AcquireSlot(Slot** slot)
+{
+    Update();
+    for (auto & s : __slots) {
+        if (__IsFree(*s)) {
+            *slot = s.get();
+            return vc::Error::Success;
+        }
+    }
+    if (__slots.size() < __maxSlots)
+        return __CreateSlot(slot);
+
+    // Pool is exhausted: stall on the oldest readback
+    Slot * oldest = __slots.front().get();
+    for (auto & s : __slots) {
+        // Slots already being processed were dispatched before any pending one
+        if (oldest->frame != 0 && (s->frame == 0 || s->frame < oldest->frame))
+            oldest = s.get();
+    }
+    if (oldest->frame != 0) {
+        if (vc::Error err = FrameSync::WaitForFrame(oldest->frame); err != vc::Error::Success)
+            return err;
+        __Dispatch(*oldest);
+    }
+    oldest->job.get();
+    *slot = oldest;
+    return vc::Error::Success;
+}
+
+vc::Error ReadbackManager::__CreateSlot(Slot** slot)
+{
+    auto newSlot = std::make_unique<Slot>();
+    const VkDeviceSize size = static_cast<VkDeviceSize>(__width) * __height * READBACK_CHANNELS;
+    if (vc::Error err = newSlot->buffer.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, __memoryProperties); err != vc::Error::Success) {
+        vc::Log::Error("Failed to create readback buffer");
+        return err;
+    }
+    *slot = newSlot.get();
+    __slots.emplace_back(std::move(newSlot));
+    return vc::Error::Success;
+}
+
+void ReadbackManager::__Dispatch(Slot& slot)
+{
+    const ReadbackFrame frame {
+        .data = slot.buffer.GetMappedData(),
+        .width = __width,
+        .height = __height,
+        .rowPitch = static_cast<size_t>(__width) * READBACK_CHANNELS,
+        .format = VK_FORMAT_R8G8B8A8_SRGB,
+        .frame = slot.frame
+    };
+    slot.frame = 0;
+
+    const vc::Config::ReadbackFormat format = vc::Config::GetInstance()->GetReadbackFormat();
+    std::string path;
+    if (format != vc::Config::ReadbackFormat::None) {
+        char fileName[32];
+        snprintf(fileName, sizeof(fileName), "frame_%06" PRIu64 ".%s", frame.frame, format == vc::Config::ReadbackFormat::PNG ? "png" : "raw");
+        path = vc::Config::GetInstance()->GetReadbackOutputPath() + "/" + fileName;
+    }
+    slot.job = vc::ThreadPool::GetGlobalThreadPool()->Submit([frame, format, path = std::move(path), callback = __callback]() {
+        if (callback)
+            callback(frame);
+        vc::Error err = vc::Error::Success;
+        if (format == vc::Config::ReadbackFormat::PNG)
+            err = vc::ImageWriter::WritePNG(path.c_str(), frame.width, frame.height, READBACK_CHANNELS, frame.data, frame.rowPitch);
+        else if (format == vc::Config::ReadbackFormat::Raw)
+            err = vc::ImageWriter::WriteRaw(path.c_str(), frame.width, frame.height, READBACK_CHANNELS, frame.data, frame.rowPitch);
+        if (err != vc::Error::Success)
+            vc::Log::Error("Failed to write readback %s", path.c_str());
+    });
+}
+}
+}
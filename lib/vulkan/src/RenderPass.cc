@@ -52,7 +52,8 @@ vc::Error RenderPass::InitRenderPass(const SwapChain* swapChain)
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     // Layout of the image before and after the render pass
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    // Offscreen images are read back with transfers instead of being presented
+    colorAttachment.finalLayout = swapChain->IsOffscreen() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
     // Color attachment reference
     VkAttachmentReference colorAttachmentRef{};
@@ -115,7 +116,7 @@ vc::Error RenderPass::InitRenderPass(const SwapChain* swapChain)
 }
 
 vc::Error RenderPass::BeginRenderPass(SwapChain* swapChain,
-    CommandBuffer* commandBuffer, int framebufferIndex)
+    CommandBuffer* commandBuffer, int framebufferIndex, VkSubpassContents contents)
 {
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -133,13 +134,27 @@ vc::Error RenderPass::BeginRenderPass(SwapChain* swapChain,
     renderPassInfo.clearValueCount = sizeof(clearColor) / sizeof(VkClearValue);
     renderPassInfo.pClearValues = clearColor;
 
-    vkCmdBeginRenderPass(commandBuffer->_commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    commandBuffer->_renderPassScope = commandBuffer->BeginGpuScope("RenderPass");
+    vkCmdBeginRenderPass(commandBuffer->_commandBuffer, &renderPassInfo, contents);
     return vc::Error::Success;
 }
 
+VkCommandBufferInheritanceInfo RenderPass::GetInheritanceInfo(const SwapChain* swapChain, int framebufferIndex) const
+{
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = __renderPass;
+    inheritanceInfo.subpass = 0;
+    // Optional but lets the driver optimize for the actual framebuffer
+    inheritanceInfo.framebuffer = swapChain->__swapChainFramebuffers[framebufferIndex];
+    return inheritanceInfo;
+}
+
 vc::Error RenderPass::EndRenderPass(CommandBuffer* commandBuffer)
 {
     vkCmdEndRenderPass(commandBuffer->_commandBuffer);
+    commandBuffer->EndGpuScope(commandBuffer->_renderPassScope);
+    commandBuffer->_renderPassScope = INVALID_GPU_SCOPE;
     return vc::Error::Success;
 }
 
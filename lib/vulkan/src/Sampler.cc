@@ -10,6 +10,7 @@
 #include <venom/vulkan/Instance.h>
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DeviceObjectCache.h>
 
 namespace venom
 {
@@ -42,10 +43,7 @@ Sampler::Sampler()
 
 Sampler::~Sampler()
 {
-    if (__sampler != VK_NULL_HANDLE) {
-        vkDestroySampler(LogicalDevice::GetVkDevice(), __sampler, Allocator::GetVKAllocationCallbacks());
-    }
-    VkSamplerCreateInfo createInfo;
+    DeviceObjectCache::Release(__sampler);
 }
 
 Sampler::Sampler(Sampler&& other)
@@ -58,6 +56,7 @@ Sampler::Sampler(Sampler&& other)
 Sampler& Sampler::operator=(Sampler&& other)
 {
     if (this != &other) {
+        DeviceObjectCache::Release(__sampler);
         __sampler = other.__sampler;
         other.__sampler = VK_NULL_HANDLE;
         __createInfo = other.__createInfo;
@@ -147,10 +146,9 @@ void Sampler::SetCreateInfo(const VkSamplerCreateInfo& createInfo)
 
 vc::Error Sampler::Create()
 {
-    if (VkResult err = vkCreateSampler(LogicalDevice::GetVkDevice(), &__createInfo, Allocator::GetVKAllocationCallbacks(), &__sampler); err != VK_SUCCESS) {
-        vc::Log::Error("Failed to create sampler: %d", err);
+    DeviceObjectCache::Release(__sampler);
+    if (__sampler = DeviceObjectCache::AcquireSampler(__createInfo); __sampler == VK_NULL_HANDLE)
         return vc::Error::Failure;
-    }
     return vc::Error::Success;
 }
 
@@ -13,6 +13,7 @@ namespace venom::vulkan
 {
 Semaphore::Semaphore()
     : __semaphore(VK_NULL_HANDLE)
+    , __isTimeline(false)
 {
 }
 
@@ -23,6 +24,7 @@ Semaphore::~Semaphore()
 
 Semaphore::Semaphore(Semaphore&& other)
     : __semaphore(other.__semaphore)
+    , __isTimeline(other.__isTimeline)
 {
     other.__semaphore = VK_NULL_HANDLE;
 }
@@ -30,7 +32,9 @@ Semaphore::Semaphore(Semaphore&& other)
 Semaphore& Semaphore::operator=(Semaphore&& other)
 {
     if (this != &other) {
+        DestroySemaphore();
         __semaphore = other.__semaphore;
+        __isTimeline = other.__isTimeline;
         other.__semaphore = VK_NULL_HANDLE;
     }
     return *this;
@@ -42,6 +46,7 @@ void Semaphore::DestroySemaphore()
         vkDestroySemaphore(LogicalDevice::GetVkDevice(), __semaphore, Allocator::GetVKAllocationCallbacks());
         __semaphore = VK_NULL_HANDLE;
     }
+    __isTimeline = false;
 }
 
 vc::Error Semaphore::InitSemaphore()
@@ -60,8 +65,81 @@ vc::Error Semaphore::InitSemaphore()
     return vc::Error::Success;
 }
 
+vc::Error Semaphore::InitTimelineSemaphore(const uint64_t initialValue)
+{
+    DestroySemaphore();
+
+    VkSemaphoreTypeCreateInfo typeInfo = {};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.pNext = nullptr;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = initialValue;
+
+    VkSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
+    semaphoreInfo.flags = 0;
+
+    if (vkCreateSemaphore(LogicalDevice::GetVkDevice(), &semaphoreInfo, Allocator::GetVKAllocationCallbacks(), &__semaphore) != VK_SUCCESS) {
+        vc::Log::Error("Failed to create timeline semaphore");
+        return vc::Error::Failure;
+    }
+    __isTimeline = true;
+    return vc::Error::Success;
+}
+
 VkSemaphore Semaphore::GetSemaphore() const
 {
     return __semaphore;
 }
+
+bool Semaphore::IsTimeline() const
+{
+    return __isTimeline;
+}
+
+uint64_t Semaphore::GetCounterValue() const
+{
+    venom_assert(__isTimeline, "Semaphore::GetCounterValue() : not a timeline semaphore");
+    uint64_t value = 0;
+    if (VkResult res = vkGetSemaphoreCounterValue(LogicalDevice::GetVkDevice(), __semaphore, &value); res != VK_SUCCESS)
+        vc::Log::Error("Failed to get semaphore counter value: %d", res);
+    return value;
+}
+
+vc::Error Semaphore::Wait(const uint64_t value, const uint64_t timeout) const
+{
+    venom_assert(__isTimeline, "Semaphore::Wait() : not a timeline semaphore");
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &__semaphore;
+    waitInfo.pValues = &value;
+
+    if (VkResult res = vkWaitSemaphores(LogicalDevice::GetVkDevice(), &waitInfo, timeout); res != VK_SUCCESS) {
+        if (res == VK_TIMEOUT)
+            return vc::Error::Failure;
+        vc::Log::Error("Failed to wait for semaphore: %d", res);
+        return res == VK_ERROR_DEVICE_LOST ? vc::Error::DeviceLost : vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+vc::Error Semaphore::Signal(const uint64_t value) const
+{
+    venom_assert(__isTimeline, "Semaphore::Signal() : not a timeline semaphore");
+    VkSemaphoreSignalInfo signalInfo = {};
+    signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+    signalInfo.pNext = nullptr;
+    signalInfo.semaphore = __semaphore;
+    signalInfo.value = value;
+
+    if (vkSignalSemaphore(LogicalDevice::GetVkDevice(), &signalInfo) != VK_SUCCESS) {
+        vc::Log::Error("Failed to signal semaphore");
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
 }
@@ -7,10 +7,20 @@
 ///
 #include <venom/vulkan/Shader.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DeletionQueue.h>
+#include <venom/vulkan/PipelineCache.h>
+#include <venom/vulkan/DeviceObjectCache.h>
+#include <venom/vulkan/BindlessTextureTable.h>
 
+#include <spirv_reflect.h>
+
+#include <algorithm>
 #include <fstream>
+#include <map>
 
 #include <venom/common/Resources.h>
+#include <venom/common/ThreadPool.h>
+#include <venom/common/Trace.h>
 
 #include <venom/common/math/Vector.h>
 #include <venom/vulkan/LogicalDevice.h>
@@ -21,30 +31,42 @@ namespace venom::vulkan
 ShaderPipeline::ShaderPipeline()
     : __graphicsPipeline(VK_NULL_HANDLE)
     , __pipelineLayout(VK_NULL_HANDLE)
+    , __ready(false)
 {
 }
 
 ShaderPipeline::~ShaderPipeline()
 {
+    // The job writes into this
+    WaitReady();
     if (__graphicsPipeline != VK_NULL_HANDLE)
-        vkDestroyPipeline(LogicalDevice::GetVkDevice(), __graphicsPipeline, Allocator::GetVKAllocationCallbacks());
-    if (__pipelineLayout != VK_NULL_HANDLE)
-        vkDestroyPipelineLayout(LogicalDevice::GetVkDevice(), __pipelineLayout, Allocator::GetVKAllocationCallbacks());
+        DeletionQueue::DestroyPipeline(__graphicsPipeline);
+    __ReleaseLayouts();
 }
 
 ShaderPipeline::ShaderPipeline(ShaderPipeline&& other) noexcept
-    : __graphicsPipeline(other.__graphicsPipeline)
-    , __pipelineLayout(other.__pipelineLayout)
+    : __graphicsPipeline(VK_NULL_HANDLE)
+    , __pipelineLayout(VK_NULL_HANDLE)
+    , __ready(false)
 {
-    other.__graphicsPipeline = VK_NULL_HANDLE;
-    other.__pipelineLayout = VK_NULL_HANDLE;
+    *this = std::move(other);
 }
 
 ShaderPipeline& ShaderPipeline::operator=(ShaderPipeline&& other) noexcept
 {
     if (this != &other) {
+        // A pending job writes into the pipeline it was submitted by
+        WaitReady();
+        other.WaitReady();
+        __ReleaseLayouts();
         __graphicsPipeline = other.__graphicsPipeline;
         __pipelineLayout = other.__pipelineLayout;
+        __descriptorSetLayouts = std::move(other.__descriptorSetLayouts);
+        __dynamicBuffers = std::move(other.__dynamicBuffers);
+        __ready = other.__ready.load();
+        __pipelineJob = {};
+        other.__ready = false;
+        other.__pipelineJob = {};
         other.__graphicsPipeline = VK_NULL_HANDLE;
         other.__pipelineLayout = VK_NULL_HANDLE;
     }
@@ -68,7 +90,12 @@ vc::Error ShaderPipeline::AddVertexBufferToLayout(const uint32_t vertexSize, con
     return vc::Error::Success;
 }
 
-vc::Error ShaderPipeline::LoadShader(const std::string& shaderPath, VkPipelineShaderStageCreateInfo* pipelineCreateInfo)
+void ShaderPipeline::SetDynamicBuffer(const uint32_t set, const uint32_t binding)
+{
+    __dynamicBuffers.emplace_back(set, binding);
+}
+
+vc::Error ShaderPipeline::LoadShader(const std::string& shaderPath, ShaderStage* stage)
 {
     const auto folder_shaderPath = std::string("compiled/") + shaderPath + ".spv";
     const std::string path = vc::Resources::GetShadersResourcePath(folder_shaderPath);
@@ -81,106 +108,286 @@ vc::Error ShaderPipeline::LoadShader(const std::string& shaderPath, VkPipelineSh
     }
 
     size_t fileSize = (size_t) file.tellg();
-    std::vector<char> buffer(fileSize);
+    if (fileSize == 0 || fileSize % sizeof(uint32_t) != 0)
+    {
+        vc::Log::Error("Invalid SPIR-V file: %s", path.c_str());
+        return vc::Error::Failure;
+    }
+    stage->path = shaderPath;
+    stage->code.resize(fileSize / sizeof(uint32_t));
     file.seekg(0);
-    file.read(buffer.data(), fileSize);
+    file.read(reinterpret_cast<char*>(stage->code.data()), fileSize);
     file.close();
+    return vc::Error::Success;
+}
+
+vc::Error ShaderPipeline::LoadShaders(const SwapChain* swapChain, const RenderPass * renderPass, const std::vector<std::string>& shaderPaths)
+{
+    std::vector<ShaderStage> stages;
+    if (vc::Error err = __LoadStages(shaderPaths, stages); err != vc::Error::Success)
+        return err;
+    if (vc::Error err = __CreateLayouts(stages); err != vc::Error::Success)
+        return err;
+    return __CreatePipeline(renderPass->GetRenderPass(), stages);
+}
+
+vc::Error ShaderPipeline::LoadShadersAsync(const SwapChain* swapChain, const RenderPass* renderPass, const std::vector<std::string>& shaderPaths)
+{
+    std::vector<ShaderStage> stages;
+    if (vc::Error err = __LoadStages(shaderPaths, stages); err != vc::Error::Success)
+        return err;
+    if (vc::Error err = __CreateLayouts(stages); err != vc::Error::Success)
+        return err;
+    // The job only reads members that don't change after this point, the pipeline is published by __ready
+    __pipelineJob = vc::ThreadPool::GetGlobalThreadPool()->Submit([this, renderPass = renderPass->GetRenderPass(), stages = std::move(stages)]() {
+        return __CreatePipeline(renderPass, stages);
+    }).share();
+    return vc::Error::Success;
+}
+
+bool ShaderPipeline::IsReady() const
+{
+    return __ready.load(std::memory_order_acquire);
+}
+
+bool ShaderPipeline::IsPending() const
+{
+    return __pipelineJob.valid() && __pipelineJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+vc::Error ShaderPipeline::WaitReady() const
+{
+    if (__pipelineJob.valid())
+        return __pipelineJob.get();
+    return IsReady() ? vc::Error::Success : vc::Error::InvalidUse;
+}
 
-    // // Reflecting shader, we'd better use that when doing a common shader
-    // {
-    //     SpvReflectShaderModule module;
-    //     SpvReflectResult result = spvReflectCreateShaderModule(buffer.size(), buffer.data(), &module);
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //
-    //     // Enumerate and extract shader's input variables
-    //     uint32_t varCount = 0;
-    //     result = spvReflectEnumerateInputVariables(&module, &varCount, nullptr);
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //     // Get input variables
-    //     std::vector<SpvReflectInterfaceVariable*> inputVars(varCount, nullptr);
-    //     result = spvReflectEnumerateInputVariables(&module, &varCount, inputVars.data());
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //
-    //     // Get descriptor bindings
-    //     result = spvReflectEnumerateDescriptorBindings(&module, &varCount, nullptr);
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //     std::vector<SpvReflectDescriptorBinding*> bindings(varCount, nullptr);
-    //     result = spvReflectEnumerateDescriptorBindings(&module, &varCount, bindings.data());
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //
-    //     // Get descriptor sets
-    //     result = spvReflectEnumerateDescriptorSets(&module, &varCount, nullptr);
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //     std::vector<SpvReflectDescriptorSet*> descriptorSets(varCount, nullptr);
-    //     result = spvReflectEnumerateDescriptorSets(&module, &varCount, descriptorSets.data());
-    //
-    //     // Get push constants
-    //     result = spvReflectEnumeratePushConstantBlocks(&module, &varCount, nullptr);
-    //     assert(result == SPV_REFLECT_RESULT_SUCCESS);
-    //     std::vector<SpvReflectBlockVariable*> pushConstants(varCount, nullptr);
-    //     result = spvReflectEnumeratePushConstantBlocks(&module, &varCount, pushConstants.data());
-    //
-    //     // Destroy the reflection data when no longer required.
-    //     spvReflectDestroyShaderModule(&module);
-    // }
-
-    VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
-    shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    shaderModuleCreateInfo.codeSize = buffer.size();
-    shaderModuleCreateInfo.pCode = reinterpret_cast<const uint32_t*>(buffer.data());
-
-    if (vkCreateShaderModule(LogicalDevice::GetVkDevice(), &shaderModuleCreateInfo, Allocator::GetVKAllocationCallbacks(), &pipelineCreateInfo->module) != VK_SUCCESS)
+vc::Error ShaderPipeline::__LoadStages(const std::vector<std::string>& shaderPaths, std::vector<ShaderStage>& stages)
+{
+    stages.resize(shaderPaths.size());
+    for (size_t i = 0; i < shaderPaths.size(); ++i)
     {
-        vc::Log::Error("Failed to create shader module");
+        if (LoadShader(shaderPaths[i], &stages[i]) != vc::Error::Success)
+        {
+            vc::Log::Error("Failed to load shader: %s", shaderPaths[i].c_str());
+            return vc::Error::Failure;
+        }
+    }
+    return vc::Error::Success;
+}
+
+/// @brief Merges the descriptor bindings of a stage into the bindings of the other stages, per set
+/// Unbounded arrays (e.g. Texture2D textures[]) get a descriptor count of 0
+static vc::Error ReflectDescriptorBindings(SpvReflectShaderModule & module, const std::string & path,
+    std::map<uint32_t, std::vector<VkDescriptorSetLayoutBinding>> & sets)
+{
+    const VkShaderStageFlagBits stage = static_cast<VkShaderStageFlagBits>(module.shader_stage);
+    uint32_t count = 0;
+    if (spvReflectEnumerateDescriptorBindings(&module, &count, nullptr) != SPV_REFLECT_RESULT_SUCCESS)
+        return vc::Error::Failure;
+    std::vector<SpvReflectDescriptorBinding*> bindings(count, nullptr);
+    if (spvReflectEnumerateDescriptorBindings(&module, &count, bindings.data()) != SPV_REFLECT_RESULT_SUCCESS)
         return vc::Error::Failure;
+
+    for (const SpvReflectDescriptorBinding * binding : bindings) {
+        // Runtime arrays have a dimension of 0
+        uint32_t descriptorCount = 1;
+        for (uint32_t i = 0; i < binding->array.dims_count; ++i)
+            descriptorCount *= binding->array.dims[i];
+        const VkDescriptorType type = static_cast<VkDescriptorType>(binding->descriptor_type);
+
+        std::vector<VkDescriptorSetLayoutBinding> & setBindings = sets[binding->set];
+        auto it = std::find_if(setBindings.begin(), setBindings.end(), [binding](const VkDescriptorSetLayoutBinding & b) {
+            return b.binding == binding->binding;
+        });
+        if (it == setBindings.end()) {
+            setBindings.push_back({binding->binding, type, descriptorCount, static_cast<VkShaderStageFlags>(stage), nullptr});
+        } else if (it->descriptorType != type || it->descriptorCount != descriptorCount) {
+            vc::Log::Error("%s: set %u binding %u declared differently by another stage", path.c_str(), binding->set, binding->binding);
+            return vc::Error::Failure;
+        } else {
+            it->stageFlags |= stage;
+        }
     }
-    pipelineCreateInfo->sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    pipelineCreateInfo->pName = "main";
-    if (shaderPath.find("vert") != std::string::npos || shaderPath.find("vertex") != std::string::npos || shaderPath.find("vs") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_VERTEX_BIT;
-    else if (shaderPath.find("frag") != std::string::npos || shaderPath.find("fs") != std::string::npos || shaderPath.find("pixel") != std::string::npos || shaderPath.find("ps") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    else if (shaderPath.find("comp") != std::string::npos || shaderPath.find("cs") != std::string::npos || shaderPath.find("compute") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    else if (shaderPath.find("geom") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_GEOMETRY_BIT;
-    else if (shaderPath.find("tesc") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
-    else if (shaderPath.find("tese") != std::string::npos)
-        pipelineCreateInfo->stage = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
-    else {
-        vc::Log::Error("Unknown shader type: %s", shaderPath.c_str());
+    return vc::Error::Success;
+}
+
+/// @brief A stage may only appear in one range: its push constant blocks are merged, then shared with the stages using the exact same range
+static vc::Error ReflectPushConstants(SpvReflectShaderModule & module, std::vector<VkPushConstantRange> & ranges)
+{
+    const VkShaderStageFlagBits stage = static_cast<VkShaderStageFlagBits>(module.shader_stage);
+    uint32_t count = 0;
+    if (spvReflectEnumeratePushConstantBlocks(&module, &count, nullptr) != SPV_REFLECT_RESULT_SUCCESS)
         return vc::Error::Failure;
+    if (count == 0)
+        return vc::Error::Success;
+    std::vector<SpvReflectBlockVariable*> blocks(count, nullptr);
+    if (spvReflectEnumeratePushConstantBlocks(&module, &count, blocks.data()) != SPV_REFLECT_RESULT_SUCCESS)
+        return vc::Error::Failure;
+
+    uint32_t begin = UINT32_MAX, end = 0;
+    for (const SpvReflectBlockVariable * block : blocks) {
+        begin = std::min(begin, block->offset);
+        end = std::max(end, block->offset + block->size);
     }
+    auto it = std::find_if(ranges.begin(), ranges.end(), [begin, end](const VkPushConstantRange & range) {
+        return range.offset == begin && range.size == end - begin;
+    });
+    if (it == ranges.end())
+        ranges.push_back({static_cast<VkShaderStageFlags>(stage), begin, end - begin});
+    else
+        it->stageFlags |= stage;
     return vc::Error::Success;
 }
 
-vc::Error ShaderPipeline::LoadShaders(const SwapChain* swapChain, const RenderPass * renderPass, const std::vector<std::string>& shaderPaths)
+/// @brief Vertex attributes of the vertex stage
+static vc::Error ReflectVertexInput(SpvReflectShaderModule & module, ShaderPipeline & pipeline)
 {
-    // Loading every shader
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStages(shaderPaths.size(), VkPipelineShaderStageCreateInfo{});
-    for (int i = 0; i < shaderPaths.size(); ++i)
+    uint32_t count = 0;
+    if (spvReflectEnumerateInputVariables(&module, &count, nullptr) != SPV_REFLECT_RESULT_SUCCESS)
+        return vc::Error::Failure;
+    std::vector<SpvReflectInterfaceVariable*> inputs(count, nullptr);
+    if (spvReflectEnumerateInputVariables(&module, &count, inputs.data()) != SPV_REFLECT_RESULT_SUCCESS)
+        return vc::Error::Failure;
+
+    for (const SpvReflectInterfaceVariable * input : inputs) {
+        if (input->decoration_flags & SPV_REFLECT_DECORATION_BUILT_IN)
+            continue;
+        if (input->format == SPV_REFLECT_FORMAT_UNDEFINED) {
+            vc::Log::Error("Unsupported vertex input at location %u", input->location);
+            return vc::Error::Failure;
+        }
+        // One tightly packed buffer per attribute, bound at the attribute's location, as meshes upload them
+        const uint32_t size = input->numeric.scalar.width / 8 * std::max(input->numeric.vector.component_count, 1u);
+        pipeline.AddVertexBufferToLayout(size, input->location, input->location, 0, static_cast<VkFormat>(input->format));
+    }
+    return vc::Error::Success;
+}
+
+vc::Error ShaderPipeline::__CreateLayouts(std::vector<ShaderStage>& stages)
+{
+    VENOM_TRACE_FUNCTION();
+    std::map<uint32_t, std::vector<VkDescriptorSetLayoutBinding>> sets;
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    // A layout given with AddVertexBufferToLayout() takes precedence
+    const bool reflectVertexInput = __attributeDescriptions.empty();
+
+    for (ShaderStage & stage : stages)
     {
-        if (LoadShader(shaderPaths[i], &shaderStages[i]) != vc::Error::Success)
+        SpvReflectShaderModule module;
+        if (spvReflectCreateShaderModule(stage.code.size() * sizeof(uint32_t), stage.code.data(), &module) != SPV_REFLECT_RESULT_SUCCESS)
         {
-            vc::Log::Error("Failed to load shader: %s", shaderPaths[i].c_str());
+            vc::Log::Error("Failed to reflect shader: %s", stage.path.c_str());
             return vc::Error::Failure;
         }
+        stage.stage = static_cast<VkShaderStageFlagBits>(module.shader_stage);
+        vc::Error err = ReflectDescriptorBindings(module, stage.path, sets);
+        if (err == vc::Error::Success)
+            err = ReflectPushConstants(module, pushConstantRanges);
+        if (err == vc::Error::Success && reflectVertexInput && stage.stage == VK_SHADER_STAGE_VERTEX_BIT)
+            err = ReflectVertexInput(module, *this);
+        spvReflectDestroyShaderModule(&module);
+        if (err != vc::Error::Success)
+        {
+            vc::Log::Error("Failed to reflect shader: %s", stage.path.c_str());
+            return err;
+        }
     }
     // Check if duplicate stages
-    for (int i = 0; i < shaderStages.size(); ++i)
+    for (size_t i = 0; i < stages.size(); ++i)
     {
-        for (int j = i + 1; j < shaderStages.size(); ++j)
+        for (size_t j = i + 1; j < stages.size(); ++j)
         {
-            if (shaderStages[i].stage == shaderStages[j].stage)
+            if (stages[i].stage == stages[j].stage)
             {
-                vc::Log::Error("Duplicate shader stages: [%s] | [%s]", shaderPaths[i].c_str(), shaderPaths[j].c_str());
-                for (int k = 0; k < shaderStages.size(); ++k) {
-                    vkDestroyShaderModule(LogicalDevice::GetVkDevice(), shaderStages[k].module, Allocator::GetVKAllocationCallbacks());
-                }
+                vc::Log::Error("Duplicate shader stages: [%s] | [%s]", stages[i].path.c_str(), stages[j].path.c_str());
+                return vc::Error::Failure;
+            }
+        }
+    }
+
+    for (const auto & [set, binding] : __dynamicBuffers) {
+        auto it = std::find_if(sets[set].begin(), sets[set].end(), [binding](const VkDescriptorSetLayoutBinding & b) {
+            return b.binding == binding;
+        });
+        if (it != sets[set].end() && it->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+            it->descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        else if (it != sets[set].end() && it->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+            it->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        else {
+            vc::Log::Error("Set %u binding %u: no uniform or storage buffer to make dynamic", set, binding);
+            return vc::Error::Failure;
+        }
+    }
+
+    // Sets skipped by the shaders still need a layout, an empty one
+    const uint32_t setCount = sets.empty() ? 0 : sets.rbegin()->first + 1;
+    __ReleaseLayouts();
+    for (uint32_t set = 0; set < setCount; ++set)
+    {
+        const std::vector<VkDescriptorSetLayoutBinding> & bindings = sets[set];
+        const bool unbounded = std::any_of(bindings.begin(), bindings.end(), [](const VkDescriptorSetLayoutBinding & binding) {
+            return binding.descriptorCount == 0;
+        });
+        VkDescriptorSetLayout layout;
+        if (unbounded) {
+            // An unbounded array of textures is the bindless texture table, alone in its set
+            if (bindings.size() != 1 || bindings[0].binding != 0 || bindings[0].descriptorType != VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE) {
+                vc::Log::Error("Set %u: unbounded arrays must be a Texture2D array alone at binding 0", set);
                 return vc::Error::Failure;
             }
+            if (!BindlessTextureTable::IsEnabled()) {
+                vc::Log::Error("Set %u: bindless textures aren't enabled on this device", set);
+                return vc::Error::Failure;
+            }
+            layout = BindlessTextureTable::AcquireDescriptorSetLayout();
+        } else {
+            layout = DeviceObjectCache::AcquireDescriptorSetLayout(bindings);
         }
+        if (layout == VK_NULL_HANDLE)
+            return vc::Error::Failure;
+        __descriptorSetLayouts.emplace_back(layout);
+    }
+
+    __pipelineLayout = DeviceObjectCache::AcquirePipelineLayout(__descriptorSetLayouts, pushConstantRanges);
+    if (__pipelineLayout == VK_NULL_HANDLE)
+        return vc::Error::Failure;
+    return vc::Error::Success;
+}
+
+void ShaderPipeline::__ReleaseLayouts()
+{
+    DeviceObjectCache::Release(__pipelineLayout);
+    __pipelineLayout = VK_NULL_HANDLE;
+    for (const VkDescriptorSetLayout layout : __descriptorSetLayouts)
+        DeviceObjectCache::Release(layout);
+    __descriptorSetLayouts.clear();
+}
+
+vc::Error ShaderPipeline::__CreatePipeline(const VkRenderPass renderPass, const std::vector<ShaderStage>& stages)
+{
+    VENOM_TRACE_FUNCTION();
+    std::vector<VkPipelineShaderStageCreateInfo> shaderStages(stages.size(), VkPipelineShaderStageCreateInfo{});
+    // Modules not created yet are VK_NULL_HANDLE, which is ignored
+    const auto destroyShaderModules = [&shaderStages]() {
+        for (const VkPipelineShaderStageCreateInfo & stage : shaderStages)
+            vkDestroyShaderModule(LogicalDevice::GetVkDevice(), stage.module, Allocator::GetVKAllocationCallbacks());
+    };
+    for (size_t i = 0; i < stages.size(); ++i)
+    {
+        VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
+        shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        shaderModuleCreateInfo.codeSize = stages[i].code.size() * sizeof(uint32_t);
+        shaderModuleCreateInfo.pCode = stages[i].code.data();
+        if (vkCreateShaderModule(LogicalDevice::GetVkDevice(), &shaderModuleCreateInfo, Allocator::GetVKAllocationCallbacks(), &shaderStages[i].module) != VK_SUCCESS)
+        {
+            vc::Log::Error("Failed to create shader module: %s", stages[i].path.c_str());
+            destroyShaderModules();
+            return vc::Error::Failure;
+        }
+        shaderStages[i].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStages[i].stage = stages[i].stage;
+        shaderStages[i].pName = "main";
     }
 
     // Input Assembly: Describes how primitives are assembled
@@ -272,41 +479,6 @@ vc::Error ShaderPipeline::LoadShaders(const SwapChain* swapChain, const RenderPa
     dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
     dynamicState.pDynamicStates = dynamicStates.data();
 
-    // Descriptor Set Layout
-    __descriptorSetLayout.AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT);
-    // Separate sampler binding
-    __descriptorSetLayout.AddBinding(1, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT);
-    __descriptorSetLayout.AddBinding(2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, VK_SHADER_STAGE_FRAGMENT_BIT);
-    // Combined image sampler
-    // __descriptorSetLayout.AddBinding(1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT);
-    if (__descriptorSetLayout.Create() != vc::Error::Success) {
-        vc::Log::Error("Failed to create descriptor set layout");
-        return vc::Error::Failure;
-    }
-
-
-    VkDescriptorSetLayout descriptorSetLayout = __descriptorSetLayout.GetLayout();
-
-    // Push constants
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.offset = 0;
-    //pushConstantRange.size = 2 * sizeof(vcm::Mat4); // View and Projection matrices
-    //pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-
-    // Pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 1; // Optional
-    pipelineLayoutInfo.pSetLayouts = &descriptorSetLayout; // Optional
-    //pipelineLayoutInfo.pushConstantRangeCount = 1; // Optional
-    //pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange; // Optional
-
-    if (vkCreatePipelineLayout(LogicalDevice::GetVkDevice(), &pipelineLayoutInfo, Allocator::GetVKAllocationCallbacks(), &__pipelineLayout) != VK_SUCCESS)
-    {
-        vc::Log::Error("Failed to create pipeline layout");
-        return vc::Error::Failure;
-    }
-
     // Vertex Input: Describes the format of the vertex data that will be passed to the vertex shader
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
     vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -329,28 +501,26 @@ vc::Error ShaderPipeline::LoadShaders(const SwapChain* swapChain, const RenderPa
     graphicsPipelineCreateInfo.pColorBlendState = &colorBlending;
     graphicsPipelineCreateInfo.pDynamicState = &dynamicState;
     graphicsPipelineCreateInfo.layout = __pipelineLayout;
-    graphicsPipelineCreateInfo.renderPass = renderPass->GetRenderPass();
+    graphicsPipelineCreateInfo.renderPass = renderPass;
     graphicsPipelineCreateInfo.subpass = 0; // Index of the subpass in the render pass where this pipeline will be used
     graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE; // Pipeline to derive from: Optional
     //graphicsPipelineCreateInfo.basePipelineIndex = -1; // Optional
 
-    if (vkCreateGraphicsPipelines(LogicalDevice::GetVkDevice(), VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &__graphicsPipeline) != VK_SUCCESS)
+    const VkResult res = vkCreateGraphicsPipelines(LogicalDevice::GetVkDevice(), PipelineCache::GetVkPipelineCache(), 1, &graphicsPipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &__graphicsPipeline);
+    // Cleaning up shader modules
+    destroyShaderModules();
+    if (res != VK_SUCCESS)
     {
-        vc::Log::Error("Failed to create graphics pipeline");
+        vc::Log::Error("Failed to create graphics pipeline: %d", res);
         return vc::Error::Failure;
     }
-
-    // Cleaning up shader modules
-    for (int i = 0; i < shaderStages.size(); ++i) {
-        vkDestroyShaderModule(LogicalDevice::GetVkDevice(), shaderStages[i].module, Allocator::GetVKAllocationCallbacks());
-    }
-
+    __ready.store(true, std::memory_order_release);
     return vc::Error::Success;
 }
 
 VkPipeline ShaderPipeline::GetPipeline() const
 {
-    return __graphicsPipeline;
+    return IsReady() ? __graphicsPipeline : VK_NULL_HANDLE;
 }
 
 VkPipelineLayout ShaderPipeline::GetPipelineLayout() const
@@ -358,8 +528,14 @@ VkPipelineLayout ShaderPipeline::GetPipelineLayout() const
     return __pipelineLayout;
 }
 
-const VkDescriptorSetLayout& ShaderPipeline::GetDescriptorSetLayout() const
+const VkDescriptorSetLayout& ShaderPipeline::GetDescriptorSetLayout(const uint32_t set) const
+{
+    venom_assert(set < __descriptorSetLayouts.size(), "ShaderPipeline::GetDescriptorSetLayout() : set not used by the shaders");
+    return __descriptorSetLayouts[set];
+}
+
+const std::vector<VkDescriptorSetLayout>& ShaderPipeline::GetDescriptorSetLayouts() const
 {
-    return __descriptorSetLayout.GetLayout();
+    return __descriptorSetLayouts;
 }
 }
@@ -0,0 +1,160 @@
+///
+/// Project: VenomEngine
+/// @file StagingRingBuffer.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/StagingRingBuffer.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static inline VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+StagingRingBuffer::StagingRingBuffer()
+    : __nextId(1)
+{
+}
+
+StagingRingBuffer::~StagingRingBuffer()
+{
+}
+
+vc::Error StagingRingBuffer::Init(const VkDeviceSize size)
+{
+    return __CreateRing(size);
+}
+
+void StagingRingBuffer::Destroy()
+{
+    __oldRings.clear();
+    __ring.reset();
+}
+
+vc::Error StagingRingBuffer::Allocate(const VkDeviceSize size, const VkDeviceSize alignment, StagingAllocation* allocation)
+{
+    venom_assert(__ring, "StagingRingBuffer not initialized");
+    VkDeviceSize offset;
+    if (!__TryAllocate(*__ring, size, alignment, &offset)) {
+        // Grow: old ring stays alive until the GPU is done with it
+        const VkDeviceSize newSize = std::max(__ring->buffer.GetSize() * 2, AlignUp(size * 2, 1024));
+        DEBUG_PRINT("Growing staging ring buffer to %" PRIu64 "MB", newSize / (1024 * 1024));
+        if (__ring->regions.empty())
+            __ring.reset();
+        else
+            __oldRings.emplace_back(std::move(__ring));
+        if (vc::Error err = __CreateRing(newSize); err != vc::Error::Success)
+            return err;
+        if (!__TryAllocate(*__ring, size, alignment, &offset))
+            return vc::Error::OutOfMemory;
+    }
+    const uint64_t id = __nextId++;
+    __ring->regions.push_back({id, offset, offset + size, 0, false});
+
+    allocation->buffer = __ring->buffer.GetVkBuffer();
+    allocation->offset = offset;
+    allocation->size = size;
+    allocation->mappedData = static_cast<char *>(__ring->buffer.GetMappedData()) + offset;
+    allocation->id = id;
+    return vc::Error::Success;
+}
+
+void StagingRingBuffer::Release(const StagingAllocation& allocation, const uint64_t completionHandle)
+{
+    auto release = [&](Ring & ring) {
+        // Most recent allocations are the most likely to be released
+        for (auto ite = ring.regions.rbegin(); ite != ring.regions.rend(); ++ite) {
+            if (ite->id == allocation.id) {
+                ite->completionHandle = completionHandle;
+                ite->released = true;
+                return true;
+            }
+        }
+        return false;
+    };
+    if (release(*__ring))
+        return;
+    for (auto & ring : __oldRings) {
+        if (release(*ring))
+            return;
+    }
+    venom_assert(false, "StagingRingBuffer::Release() : unknown allocation");
+}
+
+void StagingRingBuffer::Update(const uint64_t lastCompletedHandle)
+{
+    __Reclaim(*__ring, lastCompletedHandle);
+    for (auto & ring : __oldRings)
+        __Reclaim(*ring, lastCompletedHandle);
+    __oldRings.erase(std::remove_if(__oldRings.begin(), __oldRings.end(),
+        [](const std::unique_ptr<Ring> & ring) { return ring->regions.empty(); }), __oldRings.end());
+}
+
+VkDeviceSize StagingRingBuffer::GetCapacity() const
+{
+    return __ring ? __ring->buffer.GetSize() : 0;
+}
+
+vc::Error StagingRingBuffer::__CreateRing(const VkDeviceSize size)
+{
+    __ring = std::make_unique<Ring>();
+    if (vc::Error err = __ring->buffer.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        QueueManager::GetGraphicsComputeTransferSharingMode(),
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT); err != vc::Error::Success) {
+        vc::Log::Error("Failed to create staging ring buffer");
+        return err;
+    }
+    return vc::Error::Success;
+}
+
+bool StagingRingBuffer::__TryAllocate(Ring& ring, const VkDeviceSize size, const VkDeviceSize alignment, VkDeviceSize* offset)
+{
+    const VkDeviceSize capacity = ring.buffer.GetSize();
+    if (ring.regions.empty()) {
+        if (size > capacity)
+            return false;
+        *offset = 0;
+        return true;
+    }
+    const VkDeviceSize tail = ring.regions.front().begin;
+    const VkDeviceSize head = AlignUp(ring.regions.back().end, alignment);
+    if (ring.regions.back().end > tail) {
+        // [tail, head) used: try after head, then wrap around to the start
+        if (head + size <= capacity) {
+            *offset = head;
+            return true;
+        }
+        if (size <= tail) {
+            *offset = 0;
+            return true;
+        }
+        return false;
+    }
+    // Wrapped: free space is [head, tail)
+    if (head + size <= tail) {
+        *offset = head;
+        return true;
+    }
+    return false;
+}
+
+void StagingRingBuffer::__Reclaim(Ring& ring, const uint64_t lastCompletedHandle)
+{
+    while (!ring.regions.empty()) {
+        const Region & region = ring.regions.front();
+        if (!region.released || region.completionHandle > lastCompletedHandle)
+            break;
+        ring.regions.pop_front();
+    }
+}
+}
+}
@@ -13,6 +13,7 @@
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
 #include <venom/vulkan/QueueManager.h>
+#include <venom/vulkan/DeletionQueue.h>
 
 namespace venom::vulkan
 {
@@ -40,6 +41,7 @@ SwapChain::SwapChain(SwapChain&& other)
     : swapChain(other.swapChain)
     , swapChainImageHandles(std::move(other.swapChainImageHandles))
     , __swapChainImageViews(std::move(other.__swapChainImageViews))
+    , __offscreenImages(std::move(other.__offscreenImages))
     , capabilities(other.capabilities)
     , surfaceFormats(std::move(other.surfaceFormats))
     , presentModes(std::move(other.presentModes))
@@ -57,6 +59,7 @@ SwapChain& SwapChain::operator=(SwapChain&& other)
         swapChain = other.swapChain;
         swapChainImageHandles = std::move(other.swapChainImageHandles);
         __swapChainImageViews = std::move(other.__swapChainImageViews);
+        __offscreenImages = std::move(other.__offscreenImages);
         capabilities = other.capabilities;
         surfaceFormats = std::move(other.surfaceFormats);
         presentModes = std::move(other.presentModes);
@@ -71,18 +74,43 @@ SwapChain& SwapChain::operator=(SwapChain&& other)
 
 void SwapChain::CleanSwapChain()
 {
+    __RetireSwapChainResources();
+    if (swapChain != VK_NULL_HANDLE) {
+        DeletionQueue::DestroySwapchain(swapChain);
+        swapChain = VK_NULL_HANDLE;
+    }
+}
+
+void SwapChain::__RetireSwapChainResources()
+{
+    // Frames in flight may still render to them, the deletion queue destroys them in this order
+    // (framebuffers, then image views, then the swap chain) once they're done
     for (auto & framebuffer : __swapChainFramebuffers) {
         if (framebuffer != VK_NULL_HANDLE)
-            vkDestroyFramebuffer(LogicalDevice::GetVkDevice(), framebuffer, Allocator::GetVKAllocationCallbacks());
+            DeletionQueue::DestroyFramebuffer(framebuffer);
     }
     __swapChainFramebuffers.clear();
 
     __swapChainImageViews.clear();
+    __offscreenImages.clear();
+    swapChainImageHandles.clear();
+}
 
-    if (swapChain != VK_NULL_HANDLE) {
-        vkDestroySwapchainKHR(LogicalDevice::GetVkDevice(), swapChain, Allocator::GetVKAllocationCallbacks());
-        swapChain = VK_NULL_HANDLE;
-    }
+void SwapChain::__SetExtent(const VkExtent2D& newExtent)
+{
+    extent = newExtent;
+
+    // Viewport
+    viewport.x = 0.0f;
+    viewport.y = static_cast<float>(extent.height);
+    viewport.width = static_cast<float>(extent.width);
+    viewport.height = -static_cast<float>(extent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    // Scissor is a rectangle that defines the pixels that the rasterizer will use from the framebuffer
+    scissor.offset = {0, 0};
+    scissor.extent = extent;
 }
 
 vc::Error SwapChain::InitSwapChainSettings(const PhysicalDevice* physicalDevice, const Surface* surface, const vc::Context* context)
@@ -131,28 +159,18 @@ vc::Error SwapChain::InitSwapChainSettings(const PhysicalDevice* physicalDevice,
     }
     // Extent, if currentExtent is UINT32_MAX, then the extent can vary, else it's the currentExtent
     if (capabilities.currentExtent.width != UINT32_MAX) {
-        extent = capabilities.currentExtent;
+        __SetExtent(capabilities.currentExtent);
     } else {
         // Gets the window size in terms of total pixels, not to confuse with screen coordinates
         // Otherwise we would be using glfwGetWindowSize
         int w, h;
         glfwGetFramebufferSize(const_cast<GLFWwindow*>(context->GetWindow()), &w, &h);
 
-        extent.width = std::clamp<uint32_t>(w, capabilities.minImageExtent.width, capabilities.maxImageExtent.width);
-        extent.height = std::clamp<uint32_t>(h, capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
+        __SetExtent({
+            std::clamp<uint32_t>(w, capabilities.minImageExtent.width, capabilities.maxImageExtent.width),
+            std::clamp<uint32_t>(h, capabilities.minImageExtent.height, capabilities.maxImageExtent.height)
+        });
     }
-
-    // Viewport
-    viewport.x = 0.0f;
-    viewport.y = static_cast<float>(extent.height);
-    viewport.width = static_cast<float>(extent.width);
-    viewport.height = -static_cast<float>(extent.height);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-
-    // Scissor is a rectangle that defines the pixels that the rasterizer will use from the framebuffer
-    scissor.offset = {0, 0};
-    scissor.extent = extent;
     return vc::Error::Success;
 }
 
@@ -160,9 +178,9 @@ vc::Error SwapChain::InitSwapChain(const Surface * surface, const vc::Context *
 {
     venom_assert(capabilities.maxImageCount > 0, "Swap chain must have at least 1 image");
 
-    // If already created, then clean up first
-    if (swapChain != VK_NULL_HANDLE)
-        CleanSwapChain();
+    // If already created, the old swap chain is handed to the new one so the presentation engine can reuse
+    // its resources, it gets retired once the frames using it are done (no device idle)
+    const VkSwapchainKHR oldSwapChain = swapChain;
 
     // Image count, must be at least the minimum image count, but no more than the maximum image count
     // One more is recommeneded to avoid waiting on the driver
@@ -208,13 +226,18 @@ vc::Error SwapChain::InitSwapChain(const Surface * surface, const vc::Context *
     createInfo.clipped = VK_TRUE;
 
     // Old swap chain
-    createInfo.oldSwapchain = VK_NULL_HANDLE;
+    createInfo.oldSwapchain = oldSwapChain;
 
     // Creating SwapChain
-    if (vkCreateSwapchainKHR(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &swapChain) != VK_SUCCESS) {
+    VkSwapchainKHR newSwapChain = VK_NULL_HANDLE;
+    const VkResult result = vkCreateSwapchainKHR(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &newSwapChain);
+    // The old swap chain is retired even on failure
+    CleanSwapChain();
+    if (result != VK_SUCCESS) {
         vc::Log::Error("Failed to create swap chain");
         return vc::Error::InitializationFailed;
     }
+    swapChain = newSwapChain;
 
     // Getting handles of images in the swap chain
     vkGetSwapchainImagesKHR(LogicalDevice::GetVkDevice(), swapChain, &imageCount, nullptr);
@@ -232,6 +255,44 @@ vc::Error SwapChain::InitSwapChain(const Surface * surface, const vc::Context *
     return vc::Error::Success;
 }
 
+vc::Error SwapChain::InitOffscreen(const uint32_t width, const uint32_t height, const uint32_t imageCount)
+{
+    CleanSwapChain();
+
+    // RGBA so that readbacks can be written as they are
+    activeSurfaceFormat = {VK_FORMAT_R8G8B8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+    __SetExtent({width, height});
+
+    __offscreenImages.resize(imageCount);
+    __swapChainImageViews.resize(imageCount);
+    swapChainImageHandles.resize(imageCount);
+    for (uint32_t i = 0; i < imageCount; ++i) {
+        if (auto err = __offscreenImages[i].Create(activeSurfaceFormat.format, VK_IMAGE_TILING_OPTIMAL,
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, width, height); err != vc::Error::Success) {
+            vc::Log::Error("Failed to create offscreen image");
+            return err;
+        }
+        swapChainImageHandles[i] = __offscreenImages[i].GetVkImage();
+        if (__swapChainImageViews[i].Create(swapChainImageHandles[i], activeSurfaceFormat.format, VK_IMAGE_ASPECT_COLOR_BIT) != vc::Error::Success) {
+            vc::Log::Error("Failed to create image view");
+            return vc::Error::InitializationFailed;
+        }
+    }
+    return vc::Error::Success;
+}
+
+bool SwapChain::IsOffscreen() const
+{
+    return !__offscreenImages.empty();
+}
+
+const Image& SwapChain::GetOffscreenImage(const uint32_t index) const
+{
+    venom_assert(index < __offscreenImages.size(), "SwapChain::GetOffscreenImage() : index out of range");
+    return __offscreenImages[index];
+}
+
 vc::Error SwapChain::InitSwapChainFramebuffers(const RenderPass* renderPass)
 {
     // Create Depth Texture
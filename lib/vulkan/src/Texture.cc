@@ -11,21 +11,27 @@
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/QueueManager.h>
 #include <venom/vulkan/PhysicalDevice.h>
+#include <venom/vulkan/BindlessTextureTable.h>
+
+#include <venom/common/Trace.h>
 
 namespace venom
 {
 namespace vulkan
 {
 VulkanTexture::VulkanTexture()
+    : __bindlessIndex(BindlessTextureTable::INVALID_INDEX)
 {
 }
 
 VulkanTexture::~VulkanTexture()
 {
+    BindlessTextureTable::Unregister(__bindlessIndex);
 }
 
-vc::Error VulkanTexture::__LoadImage(unsigned char* pixels, int width, int height, int channels)
+vc::Error VulkanTexture::__LoadImage(const unsigned char* pixels, int width, int height, int channels)
 {
+    VENOM_TRACE_FUNCTION();
     // Load Image
     if (__image.Load(pixels, width, height, channels,
         VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
@@ -38,6 +44,10 @@ vc::Error VulkanTexture::__LoadImage(unsigned char* pixels, int width, int heigh
     if (__imageView.Create(__image.GetVkImage(), VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT,
         VK_IMAGE_VIEW_TYPE_2D, 0, 1, 0, 1) != vc::Error::Success)
         return vc::Error::Failure;
+
+    // Sampled through the bindless table when the device supports it
+    BindlessTextureTable::Unregister(__bindlessIndex);
+    __bindlessIndex = BindlessTextureTable::Register(__imageView.GetVkImageView());
     return vc::Error::Success;
 }
 
@@ -64,5 +74,10 @@ const ImageView& VulkanTexture::GetImageView() const
 {
     return __imageView;
 }
+
+uint32_t VulkanTexture::GetBindlessIndex() const
+{
+    return __bindlessIndex;
+}
 }
 }
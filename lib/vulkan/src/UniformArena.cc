@@ -0,0 +1,105 @@
+///
+/// Project: VenomEngine
+/// @file UniformArena.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/UniformArena.h>
+#include <venom/vulkan/PhysicalDevice.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static UniformArena * s_uniformArena = nullptr;
+
+static VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+UniformArena::UniformArena()
+    : __mappedData(nullptr)
+    , __frameSize(0)
+    , __alignment(1)
+    , __frameIndex(0)
+    , __head(0)
+{
+    s_uniformArena = this;
+}
+
+UniformArena::~UniformArena()
+{
+    s_uniformArena = nullptr;
+}
+
+vc::Error UniformArena::Init(const VkDeviceSize frameSize, const uint32_t frameCount)
+{
+    const VkPhysicalDeviceLimits & limits = PhysicalDevice::GetUsedPhysicalDevice().GetProperties().limits;
+    // Both are powers of two
+    __alignment = std::max<VkDeviceSize>(limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment);
+    __frameSize = AlignUp(frameSize, __alignment);
+    // Dynamic offsets are 32 bits
+    venom_assert(__frameSize * frameCount <= UINT32_MAX, "UniformArena too large for dynamic offsets");
+
+    vc::Error err = __buffer.CreateBuffer(__frameSize * frameCount, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        QueueManager::GetGraphicsTransferSharingMode(),
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+    );
+    if (err != vc::Error::Success) {
+        vc::Log::Error("Failed to create uniform arena");
+        return err;
+    }
+    // Memory is already persistently mapped by the DeviceMemoryAllocator
+    __mappedData = static_cast<uint8_t *>(__buffer.GetMappedData());
+    __frameIndex = 0;
+    __head = 0;
+    return vc::Error::Success;
+}
+
+void UniformArena::Destroy()
+{
+    // Buffer's move assignment doesn't release the previous buffer, its destructor does
+    Buffer released(std::move(__buffer));
+    __mappedData = nullptr;
+}
+
+void UniformArena::BeginFrame(const uint32_t frameIndex)
+{
+    UniformArena * self = s_uniformArena;
+    self->__frameIndex = frameIndex;
+    self->__head = 0;
+}
+
+UniformAllocation UniformArena::Allocate(const VkDeviceSize size)
+{
+    UniformArena * self = s_uniformArena;
+    venom_assert(self && self->__mappedData, "UniformArena not initialized");
+    const VkDeviceSize alignedSize = AlignUp(size, self->__alignment);
+    const VkDeviceSize offset = self->__head.fetch_add(alignedSize, std::memory_order_relaxed);
+    if (offset + alignedSize > self->__frameSize) {
+        // Only the allocation crossing the end logs
+        if (offset <= self->__frameSize)
+            vc::Log::Error("UniformArena: frame region full (%" PRIu64 " bytes)", self->__frameSize);
+        return {nullptr, 0};
+    }
+    const VkDeviceSize bufferOffset = self->__frameIndex * self->__frameSize + offset;
+    return {self->__mappedData + bufferOffset, static_cast<uint32_t>(bufferOffset)};
+}
+
+VkBuffer UniformArena::GetVkBuffer()
+{
+    return s_uniformArena ? s_uniformArena->__buffer.GetVkBuffer() : VK_NULL_HANDLE;
+}
+
+VkDeviceSize UniformArena::GetAlignment()
+{
+    return s_uniformArena ? s_uniformArena->__alignment : 1;
+}
+}
+}
@@ -49,7 +49,8 @@ vc::Error UniformBuffer::Init(const VkDeviceSize size)
         vc::Log::Error("Failed to create uniform buffer");
         return err;
     }
-    vkMapMemory(LogicalDevice::GetVkDevice(), __buffer.GetVkDeviceMemory(), 0, size, 0, &__mappedData);
+    // Memory is already persistently mapped by the DeviceMemoryAllocator
+    __mappedData = __buffer.GetMappedData();
     return err;
 }
 
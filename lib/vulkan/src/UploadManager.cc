@@ -0,0 +1,250 @@
+///
+/// Project: VenomEngine
+/// @file UploadManager.cc
+/// @date Oct, 16 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/UploadManager.h>
+#include <venom/vulkan/CommandPoolManager.h>
+#include <venom/vulkan/Image.h>
+#include <venom/vulkan/LogicalDevice.h>
+
+#include <venom/common/Trace.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace venom
+{
+namespace vulkan
+{
+static UploadManager * s_uploadManager = nullptr;
+
+UploadManager::UploadManager()
+    : __nextHandle(1)
+    , __lastSubmittedHandle(0)
+    , __lastCompletedHandle(0)
+    , __flushThreshold(DEFAULT_FLUSH_THRESHOLD)
+{
+    s_uploadManager = this;
+}
+
+UploadManager::~UploadManager()
+{
+    Destroy();
+    s_uploadManager = nullptr;
+}
+
+vc::Error UploadManager::Init(const VkDeviceSize stagingSize, const VkDeviceSize flushThreshold)
+{
+    __flushThreshold = flushThreshold;
+    if (vc::Error err = __timeline.InitTimelineSemaphore(0); err != vc::Error::Success)
+        return err;
+    return __stagingRing.Init(stagingSize);
+}
+
+void UploadManager::Destroy()
+{
+    if (__recordingBatch || !__inFlightBatches.empty()) {
+        WaitAll();
+    }
+    __inFlightBatches.clear();
+    __freeBatches.clear();
+    __stagingRing.Destroy();
+    __timeline.DestroySemaphore();
+}
+
+vc::Error UploadManager::UploadBuffer(const void* data, const VkDeviceSize size, const Buffer& dstBuffer, UploadHandle* handle, const VkDeviceSize dstOffset)
+{
+    VENOM_TRACE_FUNCTION();
+    venom_assert(s_uploadManager, "UploadManager not created");
+    UploadManager * self = s_uploadManager;
+    std::lock_guard<std::mutex> lock(self->__mutex);
+
+    StagingAllocation staging;
+    if (vc::Error err = self->__Stage(data, size, &staging); err != vc::Error::Success)
+        return err;
+    const VkBufferCopy copyRegion {
+        .srcOffset = staging.offset,
+        .dstOffset = dstOffset,
+        .size = size
+    };
+    vkCmdCopyBuffer(self->__recordingBatch->commandBuffer->GetVkCommandBuffer(), staging.buffer, dstBuffer.GetVkBuffer(), 1, &copyRegion);
+    return self->__EndCopy(staging, size, handle);
+}
+
+vc::Error UploadManager::UploadImage(const void* data, const VkDeviceSize size, Image& image, const VkFormat format, UploadHandle* handle)
+{
+    VENOM_TRACE_FUNCTION();
+    venom_assert(s_uploadManager, "UploadManager not created");
+    UploadManager * self = s_uploadManager;
+    std::lock_guard<std::mutex> lock(self->__mutex);
+
+    StagingAllocation staging;
+    if (vc::Error err = self->__Stage(data, size, &staging); err != vc::Error::Success)
+        return err;
+    CommandBuffer * commandBuffer = self->__recordingBatch->commandBuffer;
+    commandBuffer->TransitionImageLayout(image, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    commandBuffer->CopyBufferToImage(staging.buffer, staging.offset, image);
+    commandBuffer->TransitionUploadedImage(image);
+    return self->__EndCopy(staging, size, handle);
+}
+
+vc::Error UploadManager::Flush()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    std::lock_guard<std::mutex> lock(s_uploadManager->__mutex);
+    return s_uploadManager->__Flush();
+}
+
+void UploadManager::Update()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    std::lock_guard<std::mutex> lock(s_uploadManager->__mutex);
+    s_uploadManager->__Update();
+}
+
+bool UploadManager::IsComplete(const UploadHandle handle)
+{
+    return handle <= s_uploadManager->__lastCompletedHandle.load(std::memory_order_acquire);
+}
+
+bool UploadManager::IsSubmitted(const UploadHandle handle)
+{
+    return handle <= s_uploadManager->__lastSubmittedHandle.load(std::memory_order_acquire);
+}
+
+UploadHandle UploadManager::GetCompletedHandle()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    return s_uploadManager->__lastCompletedHandle.load(std::memory_order_acquire);
+}
+
+UploadHandle UploadManager::GetSubmittedHandle()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    return s_uploadManager->__lastSubmittedHandle.load(std::memory_order_acquire);
+}
+
+VkSemaphore UploadManager::GetTimelineSemaphore()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    return s_uploadManager->__timeline.GetSemaphore();
+}
+
+UploadHandle UploadManager::GetLatestHandle()
+{
+    venom_assert(s_uploadManager, "UploadManager not created");
+    return s_uploadManager->__nextHandle - 1;
+}
+
+vc::Error UploadManager::Wait(const UploadHandle handle)
+{
+    if (handle == 0)
+        return vc::Error::Success;
+    UploadManager * self = s_uploadManager;
+    std::lock_guard<std::mutex> lock(self->__mutex);
+
+    if (self->__recordingBatch && self->__recordingBatch->handle <= handle) {
+        if (vc::Error err = self->__Flush(); err != vc::Error::Success)
+            return err;
+    }
+    if (handle > self->__lastCompletedHandle.load(std::memory_order_relaxed)) {
+        if (vc::Error err = self->__timeline.Wait(handle); err != vc::Error::Success)
+            return err;
+    }
+    self->__Update();
+    return vc::Error::Success;
+}
+
+void UploadManager::WaitAll()
+{
+    Wait(s_uploadManager->__nextHandle - 1);
+}
+
+vc::Error UploadManager::__BeginBatch()
+{
+    vc::Error err;
+    if (!__freeBatches.empty()) {
+        __recordingBatch = std::move(__freeBatches.back());
+        __freeBatches.pop_back();
+        __recordingBatch->commandBuffer->Reset(0);
+    } else {
+        auto batch = std::make_unique<Batch>();
+        if (err = CommandPoolManager::GetTransferCommandPool()->CreateCommandBuffer(&batch->commandBuffer, VK_COMMAND_BUFFER_LEVEL_PRIMARY); err != vc::Error::Success)
+            return err;
+        __recordingBatch = std::move(batch);
+    }
+    __recordingBatch->handle = __nextHandle++;
+    __recordingBatch->recordedBytes = 0;
+    if (err = __recordingBatch->commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
+        return err;
+    return vc::Error::Success;
+}
+
+vc::Error UploadManager::__Stage(const void* data, const VkDeviceSize size, StagingAllocation* staging)
+{
+    vc::Error err;
+    if (!__recordingBatch) {
+        if (err = __BeginBatch(); err != vc::Error::Success)
+            return err;
+    }
+    if (err = __stagingRing.Allocate(size, STAGING_ALIGNMENT, staging); err != vc::Error::Success) {
+        vc::Log::Error("Failed to allocate %" PRIu64 " bytes of staging memory", size);
+        return err;
+    }
+    memcpy(staging->mappedData, data, size);
+    return vc::Error::Success;
+}
+
+vc::Error UploadManager::__EndCopy(const StagingAllocation& staging, const VkDeviceSize size, UploadHandle* handle)
+{
+    Batch * batch = __recordingBatch.get();
+    __stagingRing.Release(staging, batch->handle);
+    batch->recordedBytes += size;
+    *handle = batch->handle;
+    // Big batches are submitted right away so the GPU starts copying while we keep recording
+    if (batch->recordedBytes >= __flushThreshold)
+        return __Flush();
+    return vc::Error::Success;
+}
+
+vc::Error UploadManager::__Flush()
+{
+    if (!__recordingBatch)
+        return vc::Error::Success;
+    VENOM_TRACE_ZONE("UploadManager::Flush");
+
+    Batch * batch = __recordingBatch.get();
+    vc::Error err = batch->commandBuffer->EndCommandBuffer();
+    if (err == vc::Error::Success)
+        err = batch->commandBuffer->SubmitToQueue(__timeline, batch->handle);
+    if (err != vc::Error::Success) {
+        // The GPU will never signal this batch's handle: signal it from the host once the batches before it are done,
+        // so waiters and the staging ranges released on it don't wait forever. Its copies are lost
+        __timeline.Wait(batch->handle - 1);
+        __timeline.Signal(batch->handle);
+        __lastSubmittedHandle.store(batch->handle, std::memory_order_release);
+        __freeBatches.emplace_back(std::move(__recordingBatch));
+        return err;
+    }
+    __lastSubmittedHandle.store(batch->handle, std::memory_order_release);
+    __inFlightBatches.emplace_back(std::move(__recordingBatch));
+    return vc::Error::Success;
+}
+
+void UploadManager::__Update()
+{
+    // Batches are submitted in order on the same queue, one query retires all the completed ones
+    if (!__inFlightBatches.empty())
+        __lastCompletedHandle.store(__timeline.GetCounterValue(), std::memory_order_release);
+    const UploadHandle completedHandle = __lastCompletedHandle.load(std::memory_order_relaxed);
+    while (!__inFlightBatches.empty() && __inFlightBatches.front()->handle <= completedHandle) {
+        __freeBatches.emplace_back(std::move(__inFlightBatches.front()));
+        __inFlightBatches.pop_front();
+    }
+    __stagingRing.Update(completedHandle);
+}
+}
+}
@@ -17,6 +17,9 @@ namespace venom
 namespace vulkan
 {
 VertexBuffer::VertexBuffer()
+    : __vertexCount(0)
+    , __vertexSize(0)
+    , __uploadHandle(0)
 {
 }
 
@@ -26,6 +29,9 @@ VertexBuffer::~VertexBuffer()
 
 VertexBuffer::VertexBuffer(VertexBuffer&& other)
     : __buffer(std::move(other.__buffer))
+    , __vertexCount(other.__vertexCount)
+    , __vertexSize(other.__vertexSize)
+    , __uploadHandle(other.__uploadHandle)
 {
 }
 
@@ -33,27 +39,25 @@ VertexBuffer& VertexBuffer::operator=(VertexBuffer && other)
 {
     if (this != &other) {
         __buffer = std::move(other.__buffer);
+        __vertexCount = other.__vertexCount;
+        __vertexSize = other.__vertexSize;
+        __uploadHandle = other.__uploadHandle;
     }
     return *this;
 }
 
 vc::Error VertexBuffer::Init(const uint32_t vertexCount, const uint32_t vertexSize, const VkBufferUsageFlags flags, const void* data)
 {
-    Buffer stagingBuffer;
-    stagingBuffer.CreateBuffer(vertexCount * vertexSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        QueueManager::GetGraphicsTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-    stagingBuffer.WriteBuffer(data);
-
-    __buffer.CreateBuffer(vertexCount * vertexSize,
+    vc::Error err;
+    if (err = __buffer.CreateBuffer(vertexCount * vertexSize,
         VK_BUFFER_USAGE_TRANSFER_DST_BIT | flags,
         QueueManager::GetGraphicsTransferSharingMode(),
         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
+    ); err != vc::Error::Success)
+        return err;
 
-    if (auto err = CopyBuffer(stagingBuffer, __buffer, vertexCount * vertexSize); err != vc::Error::Success)
+    // Data goes through the staging ring, copy is recorded in the current upload batch
+    if (err = UploadManager::UploadBuffer(data, vertexCount * vertexSize, __buffer, &__uploadHandle); err != vc::Error::Success)
         return err;
 
     __vertexCount = vertexCount;
@@ -66,28 +70,14 @@ VkBuffer VertexBuffer::GetVkBuffer() const
     return __buffer.GetVkBuffer();
 }
 
-vc::Error VertexBuffer::CopyBuffer(const Buffer& srcBuffer, const Buffer& dstBuffer, const VkDeviceSize size)
+UploadHandle VertexBuffer::GetUploadHandle() const
 {
-    vc::Error err;
-    CommandPool * transferCommandPool = CommandPoolManager::GetTransferCommandPool();
-    CommandBuffer * commandBuffer = nullptr;
-    if (err = transferCommandPool->CreateCommandBuffer(&commandBuffer, VK_COMMAND_BUFFER_LEVEL_PRIMARY); err != vc::Error::Success)
-        return err;
-    if (err = commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
-        return err;
-    {
-        const VkBufferCopy copyRegion {
-            .srcOffset = 0,
-            .dstOffset = 0,
-            .size = size
-        };
-        vkCmdCopyBuffer(commandBuffer->GetVkCommandBuffer(), srcBuffer.GetVkBuffer(), dstBuffer.GetVkBuffer(), 1, &copyRegion);
-    }
-    if (err = commandBuffer->EndCommandBuffer(); err != vc::Error::Success)
-        return err;
-    commandBuffer->SubmitToQueue();
-    commandBuffer->WaitForQueue();
-    return vc::Error::Success;
+    return __uploadHandle;
+}
+
+bool VertexBuffer::IsUploaded() const
+{
+    return UploadManager::IsComplete(__uploadHandle);
 }
 
 uint32_t VertexBuffer::GetVertexCount() const
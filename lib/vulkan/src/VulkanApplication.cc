@@ -8,12 +8,21 @@
 #include <venom/vulkan/VulkanApplication.h>
 
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <vector>
 
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/DescriptorWriter.h>
 
 #include <venom/common/FpsCounter.h>
+#include <venom/common/FrameProfiler.h>
+#include <venom/common/Config.h>
+#include <venom/common/ThreadPool.h>
+#include <venom/common/Trace.h>
 
 #include <venom/vulkan/plugin/graphics/Texture.h>
 
@@ -28,11 +37,31 @@ static constexpr std::array s_deviceExtensions = {
 #endif
 };
 
+/// @brief Set 0 of the non bindless shader, as read by the draw set template
+struct DrawSetDescriptors
+{
+    VkDescriptorBufferInfo uniforms;
+    VkDescriptorImageInfo sampler;
+    VkDescriptorImageInfo texture;
+    VkDescriptorBufferInfo objects;
+};
+
+/// @brief Diffuse texture of the mesh's material, fallback if it has none
+static const VulkanTexture * GetDrawTexture(const VulkanMesh * mesh, const VulkanTexture * fallback)
+{
+    if (const vc::Material * material = mesh->GetMaterial()) {
+        if (const vc::Texture * texture = material->GetComponent(vc::MaterialComponentType::DIFFUSE).GetTexture())
+            return texture->As<VulkanTexture>();
+    }
+    return fallback;
+}
+
 VulkanApplication::VulkanApplication()
     : vc::GraphicsApplication()
     , DebugApplication()
     , __context()
     , __currentFrame(0)
+    , __frameCount(0)
     , __framebufferChanged(false)
     , __shouldClose(false)
 {
@@ -42,6 +71,9 @@ VulkanApplication::VulkanApplication()
 VulkanApplication::~VulkanApplication()
 {
     vc::Log::Print("Destroying Vulkan app...");
+#ifdef VENOM_DEBUG
+    DeviceMemoryAllocator::LogStats();
+#endif
     // Set global physical device back to nullptr
     PhysicalDevice::SetUsedPhysicalDevice(nullptr);
 #ifdef VENOM_DEBUG
@@ -64,7 +96,8 @@ vc::Error VulkanApplication::Init()
         return vc::Error::InitializationFailed;
     }
 
-    __SetGLFWCallbacks();
+    if (!__context.IsHeadless())
+        __SetGLFWCallbacks();
 
     if (res = __InitVulkan(); res != vc::Error::Success)
     {
@@ -73,10 +106,24 @@ vc::Error VulkanApplication::Init()
     }
 
     __texture = vc::Texture::Create("hank_happy.png");
+    // Every frame's set in one update
+    DescriptorWriter writer;
     for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+        // View, Projection
+        writer.WriteBuffer(__descriptorSets[i], 0, __uniformBuffers[i], 0, sizeof(vcm::Mat4) * 2);
+        // Model, offset per draw into the uniform arena
+        writer.WriteBuffer(__descriptorSets[i].GetVkDescriptorSet(), 3, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, UniformArena::GetVkBuffer(), 0, sizeof(vcm::Mat4));
         // Separate Sampled Image & Sampler
-        __descriptorSets[i].UpdateSampler(__sampler, 1, VK_DESCRIPTOR_TYPE_SAMPLER, 1, 0);
-        __descriptorSets[i].UpdateTexture(reinterpret_cast<VulkanTexture*>(__texture), 2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
+        writer.WriteSampler(__descriptorSets[i], 1, __sampler);
+        // Bindless textures are indexed per draw instead
+        if (!BindlessTextureTable::IsEnabled())
+            writer.WriteTexture(__descriptorSets[i], 2, reinterpret_cast<VulkanTexture*>(__texture));
+    }
+    writer.Flush();
+    // Offscreen frames are captured and measured, none of them may be skipped
+    if (__context.IsHeadless()) {
+        if (res = __shaderPipeline.WaitReady(); res != vc::Error::Success)
+            return vc::Error::InitializationFailed;
     }
     return vc::Error::Success;
 }
@@ -94,11 +141,17 @@ vc::Error VulkanApplication::__Loop()
     static vc::FpsCounter fps;
     static vc::Timer timer;
 
-    vc::Timer pollP;
-    __context.PollEvents();
-    //vc::Log::Print("Poll time: %lu", pollP.GetMicroSeconds());
+    vc::FrameProfiler * profiler = vc::FrameProfiler::GetInstance();
+    profiler->BeginFrame();
+    {
+        VENOM_TRACE_ZONE("PollEvents");
+        vc::FramePhaseScope pollScope(vc::FramePhase::Poll);
+        __context.PollEvents();
+    }
     if (err = __DrawFrame(); err != vc::Error::Success)
         return err;
+    profiler->EndFrame();
+    ++__frameCount;
     fps.RegisterFrame();
     auto duration = timer.GetMilliSeconds();
     if (duration >= 1000) {
@@ -106,9 +159,13 @@ vc::Error VulkanApplication::__Loop()
             vc::Log::Print("FPS: %u, Theoretical FPS: %.2f", fpsCount, _GetTheoreticalFPS(fpsCount));
         timer.Reset();
     }
-    __shouldClose = __context.ShouldClose();
+    const uint64_t maxFrameCount = vc::Config::GetInstance()->GetMaxFrameCount();
+    __shouldClose = __context.ShouldClose() || (maxFrameCount != 0 && __frameCount >= maxFrameCount);
     if (__shouldClose) {
         vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+        // Every frame is done, write what's left
+        ReadbackManager::Flush();
+        GpuProfiler::LogStats();
     }
     return err;
 }
@@ -118,88 +175,135 @@ void VulkanApplication::__UpdateUniformBuffers()
     static vc::Timer timer_uni;
     float time = timer_uni.GetMilliSeconds();
 
-    vcm::Mat4 modelViewAndProj[3];
-    modelViewAndProj[0] = vcm::Identity();
-    vcm::RotateMatrix(modelViewAndProj[0], {0.0f, 0.0f, 1.0f}, time / 1000.0f);
-    modelViewAndProj[1] = vcm::LookAt({2.0f, 2.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
-    modelViewAndProj[2] = vcm::Perspective(45.0f, (float)__swapChain.extent.width / (float)__swapChain.extent.height, 0.1f, 10.0f);
+    // Model, written per draw into the uniform arena by __RecordDraws()
+    __objectTransform = vcm::Identity();
+    vcm::RotateMatrix(__objectTransform, {0.0f, 0.0f, 1.0f}, time / 1000.0f);
+
+    const vcm::Vec3 cameraPosition(2.0f, 2.0f, 1.0f);
+    const float fov = 45.0f;
+    vcm::Mat4 viewAndProj[2];
+    viewAndProj[0] = vcm::LookAt(cameraPosition, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    viewAndProj[1] = vcm::Perspective(fov, (float)__swapChain.extent.width / (float)__swapChain.extent.height, 0.1f, 10.0f);
+    __lodView = {cameraPosition, 1.0f / fabsf(tanf(fov * 0.5f))};
 
     // Uniform buffers (view and projection)
-    memcpy(__uniformBuffers[__currentFrame].GetMappedData(), modelViewAndProj, sizeof(modelViewAndProj));
-    // Push Constants (model)
-    // __commandBuffers[__currentFrame]->PushConstants(&__shaderPipeline, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(vcm::Mat4), &model);
+    memcpy(__uniformBuffers[__currentFrame].GetMappedData(), viewAndProj, sizeof(viewAndProj));
 }
 
 vc::Error VulkanApplication::__DrawFrame()
 {
+    VENOM_TRACE_FUNCTION();
+    // Submit uploads recorded since last frame & recycle the finished ones
+    if (auto err = UploadManager::Flush(); err != vc::Error::Success)
+        return err;
+    UploadManager::Update();
+
     // Draw image
+    const bool headless = __swapChain.IsOffscreen();
+
+    // Resize events come in bursts while the window is dragged, only recreate once they settle
+    if (!headless && __framebufferChanged && __resizeTimer.GetMilliSeconds() >= SWAP_CHAIN_RESIZE_DEBOUNCE_MS) {
+        if (auto err = __RecreateSwapChain(); err != vc::Error::Success)
+            return err;
+    }
+    // Minimized, nothing to present to: sleep in the event loop until the window is restored (or closed)
+    if (__swapChain.extent.width == 0 || __swapChain.extent.height == 0) {
+        if (headless)
+            return vc::Error::Success;
+        int width = 0, height = 0;
+        glfwGetFramebufferSize(__context.GetWindow(), &width, &height);
+        while ((width == 0 || height == 0) && !__context.ShouldClose()) {
+            glfwWaitEvents();
+            glfwGetFramebufferSize(__context.GetWindow(), &width, &height);
+        }
+        // Restored, no resize burst to wait for
+        return __context.ShouldClose() ? vc::Error::Success : __RecreateSwapChain();
+    }
 
-    // Wait for the fence to be signaled
-    vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __inFlightFences[__currentFrame].GetFence(), VK_TRUE, UINT64_MAX);
+    // Wait for the GPU to be done with the frame that used this slot
+    {
+        VENOM_TRACE_ZONE("WaitForFrame");
+        if (auto err = __frameSync.BeginFrame(); err != vc::Error::Success)
+            return err;
+    }
+    __currentFrame = FrameSync::GetFrameIndex();
+    // Textures registered since last frame, in a single descriptor update
+    BindlessTextureTable::Update();
 
     uint32_t imageIndex;
-    VkResult result = vkAcquireNextImageKHR(LogicalDevice::GetVkDevice(), __swapChain.swapChain, UINT64_MAX, __imageAvailableSemaphores[__currentFrame].GetSemaphore(), VK_NULL_HANDLE, &imageIndex);
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || __framebufferChanged) {
-        __framebufferChanged = false;
-        vc::Log::Print("Recreating swap chain");
-        __RecreateSwapChain();
-        return vc::Error::Success;
-    } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
-        vc::Log::Error("Failed to acquire swap chain image");
-        return vc::Error::Failure;
+    VkResult result = VK_SUCCESS;
+    if (headless) {
+        // One offscreen image per frame slot, BeginFrame() made sure the GPU is done with it
+        imageIndex = __currentFrame;
+    } else {
+        result = vkAcquireNextImageKHR(LogicalDevice::GetVkDevice(), __swapChain.swapChain, UINT64_MAX, __frameSync.GetImageAvailableSemaphore(), VK_NULL_HANDLE, &imageIndex);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+            // Can't present anymore, recreate right away. Nothing was acquired so the semaphore is still unsignaled
+            return __RecreateSwapChain();
+        } else if (result == VK_SUBOPTIMAL_KHR) {
+            // Still presentable, recreate once pending resize events settle
+            __framebufferChanged = true;
+        } else if (result != VK_SUCCESS) {
+            vc::Log::Error("Failed to acquire swap chain image");
+            return vc::Error::Failure;
+        }
     }
 
-    // If we reset before, then it will wait endlessly as no work is done
-    vkResetFences(LogicalDevice::GetVkDevice(), 1, __inFlightFences[__currentFrame].GetFence());
-    __commandBuffers[__currentFrame]->Reset(0);
+    vc::Timer recordTimer;
+    // GPU is done with this frame: recycle its command pools, no command buffer gets allocated in steady state
+    if (auto err = CommandPoolManager::BeginFrame(__currentFrame); err != vc::Error::Success)
+        return err;
+    if (auto err = DescriptorAllocator::BeginFrame(__currentFrame); err != vc::Error::Success)
+        return err;
+    UniformArena::BeginFrame(__currentFrame);
+    CommandBuffer * commandBuffer = nullptr;
+    if (auto err = CommandPoolManager::GetFrameCommandPool()->AcquireCommandBuffer(&commandBuffer); err != vc::Error::Success)
+        return err;
 
-    if (auto err = __commandBuffers[__currentFrame]->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
+    if (auto err = commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
         return err;
+    GpuProfiler::BeginFrame(commandBuffer);
 
         // Update Uniform Buffers
         __UpdateUniformBuffers();
 
-        __renderPass.BeginRenderPass(&__swapChain, __commandBuffers[__currentFrame], imageIndex);
-        __commandBuffers[__currentFrame]->BindPipeline(__shaderPipeline.GetPipeline(), VK_PIPELINE_BIND_POINT_GRAPHICS);
-        __commandBuffers[__currentFrame]->SetViewport(__swapChain.viewport);
-        __commandBuffers[__currentFrame]->SetScissor(__swapChain.scissor);
-        //__descriptorSets[__currentFrame].UpdateTexture(reinterpret_cast<const VulkanTexture*>(__texture), 2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
-        __commandBuffers[__currentFrame]->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, __shaderPipeline.GetPipelineLayout(), 0, 1, __descriptorSets[__currentFrame].GetVkDescriptorSet());
-        __commandBuffers[__currentFrame]->DrawMesh(__mesh);
-        // TODO: Create Descriptor Set for each mesh
-        // __descriptorSets[__currentFrame].UpdateTexture(reinterpret_cast<const VulkanTexture*>(__model->GetMeshes()[0]->GetMaterial()->GetComponent(vc::MaterialComponentType::DIFFUSE).GetTexture()), 2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
-        __commandBuffers[__currentFrame]->DrawModel(__model);
-        __renderPass.EndRenderPass(__commandBuffers[__currentFrame]);
-
-    if (auto err = __commandBuffers[__currentFrame]->EndCommandBuffer(); err != vc::Error::Success)
+        // Render pass with every draw (inline or through secondary command buffers)
+        if (auto err = __RecordDraws(commandBuffer, imageIndex); err != vc::Error::Success)
+            return err;
+
+        // Copy the frame back once the render pass is done, processed a few frames later
+        if (headless && ReadbackManager::IsEnabled()) {
+            if (auto err = ReadbackManager::RecordReadback(commandBuffer, __swapChain.GetOffscreenImage(imageIndex)); err != vc::Error::Success)
+                return err;
+        }
+
+    GpuProfiler::EndFrame(commandBuffer);
+    if (auto err = commandBuffer->EndCommandBuffer(); err != vc::Error::Success)
         return err;
+    vc::FrameProfiler::GetInstance()->AddPhaseTime(vc::FramePhase::Record, recordTimer.GetNanoSeconds());
 
-    // Synchronization between the image being presented and the image being rendered
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-
-    VkSemaphore waitSemaphores[] = {__imageAvailableSemaphores[__currentFrame].GetSemaphore()};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    VkCommandBuffer commandBuffers[] = {*reinterpret_cast<VkCommandBuffer*>(__commandBuffers[__currentFrame])};
-    submitInfo.pCommandBuffers = commandBuffers;
-    VkSemaphore signalSemaphores[] = {__renderFinishedSemaphores[__currentFrame].GetSemaphore()};
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
+    // Uploads recorded while the frame was, e.g. textures registered by other threads
+    if (auto err = UploadManager::Flush(); err != vc::Error::Success)
+        return err;
 
+    // Waits for the acquired image and every submitted upload, signals the present semaphore & the frame's timeline value
+    // Grabbed before submitting, submission moves on to the next frame slot
+    VkSemaphore signalSemaphores[] = {headless ? VK_NULL_HANDLE : __frameSync.GetRenderFinishedSemaphore()};
     vc::Timer theoreticalFpsCounter;
-    if (result = vkQueueSubmit(__graphicsQueue.GetVkQueue(), 1, &submitInfo, *__inFlightFences[__currentFrame].GetFence()); result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || __framebufferChanged) {
-        __framebufferChanged = false;
-        __RecreateSwapChain();
-        return vc::Error::Success;
-    } else if (result != VK_SUCCESS) {
+    if (auto err = __frameSync.SubmitFrame(__graphicsQueue, commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        UploadManager::GetTimelineSemaphore(), UploadManager::GetSubmittedHandle()); err != vc::Error::Success) {
         vc::Log::Error("Failed to submit draw command buffer");
-        return vc::Error::Failure;
+        return err;
     }
     _UpdateTheoreticalFPS(theoreticalFpsCounter.GetMicroSeconds());
+    vc::FrameProfiler::GetInstance()->AddPhaseTime(vc::FramePhase::Submit, theoreticalFpsCounter.GetNanoSeconds());
+
+    vc::FramePhaseScope presentScope(vc::FramePhase::Present);
+    // Nothing to present, hand the readbacks of finished frames to the workers instead
+    if (headless) {
+        ReadbackManager::Update();
+        return vc::Error::Success;
+    }
 
     VkPresentInfoKHR presentInfo{};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
@@ -213,9 +317,157 @@ vc::Error VulkanApplication::__DrawFrame()
 
     presentInfo.pImageIndices = &imageIndex;
 
-    vkQueuePresentKHR(__presentQueue.GetVkQueue(), &presentInfo);
+    result = vkQueuePresentKHR(__presentQueue.GetVkQueue(), &presentInfo);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+        __framebufferChanged = true;
+    return vc::Error::Success;
+}
+
+void VulkanApplication::__BindDrawState(CommandBuffer* commandBuffer)
+{
+    commandBuffer->BindPipeline(__shaderPipeline.GetPipeline(), VK_PIPELINE_BIND_POINT_GRAPHICS);
+    commandBuffer->SetViewport(__swapChain.viewport);
+    commandBuffer->SetScissor(__swapChain.scissor);
+    // Set 0 is bound per draw by __RecordDrawRange(), with the draw's object offset
+    // Every texture of the frame, whatever the number of materials
+    if (BindlessTextureTable::IsEnabled())
+        commandBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, __shaderPipeline.GetPipelineLayout(), 1, 1, BindlessTextureTable::GetVkDescriptorSet());
+}
+
+void VulkanApplication::__RecordDrawRange(CommandBuffer* commandBuffer, const size_t begin, const size_t end)
+{
+    const bool bindless = !__drawTextureIndices.empty();
+    const bool perDrawSets = !__drawDescriptorSets.empty();
+    uint32_t textureIndex = BindlessTextureTable::INVALID_INDEX;
+    for (size_t i = begin; i < end; ++i) {
+        // Only pushed when it changes, consecutive meshes often share their material
+        if (bindless && __drawTextureIndices[i] != textureIndex) {
+            textureIndex = __drawTextureIndices[i];
+            commandBuffer->PushConstants(&__shaderPipeline, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t), &textureIndex);
+        }
+        // Rebinding with a new dynamic offset is cheap, the set itself isn't rewritten
+        const VkDescriptorSet descriptorSet = perDrawSets ? __drawDescriptorSets[i] : __descriptorSets[__currentFrame].GetVkDescriptorSet();
+        commandBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, __shaderPipeline.GetPipelineLayout(), 0, 1, descriptorSet, 1, &__drawObjectOffsets[i]);
+        commandBuffer->DrawMesh(__drawList[i], __drawLods[i]);
+    }
+}
+
+vc::Error VulkanApplication::__RecordDraws(CommandBuffer* commandBuffer, uint32_t imageIndex)
+{
+    // Pipeline still compiling: the frame is only cleared
+    if (!__shaderPipeline.IsReady()) {
+        // The compile can finish between the two queries, the job publishes the pipeline before completing
+        if (!__shaderPipeline.IsPending() && !__shaderPipeline.IsReady()) {
+            vc::Log::Error("Graphics pipeline failed to compile");
+            return vc::Error::Failure;
+        }
+        __renderPass.BeginRenderPass(&__swapChain, commandBuffer, imageIndex);
+        __renderPass.EndRenderPass(commandBuffer);
+        return vc::Error::Success;
+    }
+
+    // Draw list
+    __drawList.clear();
+    __drawList.emplace_back(__mesh);
+    for (vc::Mesh * mesh : __model->GetMeshes())
+        __drawList.emplace_back(mesh->As<VulkanMesh>());
+
+    // Selection keeps per mesh state for its hysteresis: done here, not by the recording jobs
+    __drawLods.clear();
+    for (VulkanMesh * mesh : __drawList)
+        __drawLods.emplace_back(mesh->SelectLod(mesh->GetScreenSize(__objectTransform, __lodView)));
+
+    // Per object data of each draw, in the frame's region of the uniform arena
+    __drawObjectOffsets.clear();
+    for (size_t i = 0; i < __drawList.size(); ++i) {
+        const UniformAllocation allocation = UniformArena::Allocate(sizeof(vcm::Mat4));
+        if (allocation.data == nullptr)
+            return vc::Error::OutOfMemory;
+        memcpy(allocation.data, &__objectTransform, sizeof(vcm::Mat4));
+        __drawObjectOffsets.emplace_back(allocation.offset);
+    }
+
+    // Each mesh samples its material's diffuse texture, the test texture if it has none
+    const VulkanTexture * defaultTexture = reinterpret_cast<const VulkanTexture*>(__texture);
+    __drawTextureIndices.clear();
+    __drawDescriptorSets.clear();
+    if (BindlessTextureTable::IsEnabled()) {
+        // Bindless: only the texture's index changes per draw
+        for (const VulkanMesh * mesh : __drawList) {
+            const uint32_t textureIndex = GetDrawTexture(mesh, defaultTexture)->GetBindlessIndex();
+            __drawTextureIndices.emplace_back(textureIndex != BindlessTextureTable::INVALID_INDEX ? textureIndex : defaultTexture->GetBindlessIndex());
+        }
+    } else {
+        // One transient set per texture, recycled with the frame's descriptor pools
+        __textureDescriptorSets.clear();
+        for (const VulkanMesh * mesh : __drawList) {
+            const VulkanTexture * texture = GetDrawTexture(mesh, defaultTexture);
+            auto [it, inserted] = __textureDescriptorSets.try_emplace(texture, VK_NULL_HANDLE);
+            if (inserted) {
+                DescriptorSet set = DescriptorAllocator::AllocateFrameSet(__shaderPipeline.GetDescriptorSetLayout());
+                if (set.GetVkDescriptorSet() == VK_NULL_HANDLE)
+                    return vc::Error::Failure;
+                const DrawSetDescriptors descriptors {
+                    .uniforms = {__uniformBuffers[__currentFrame].GetVkBuffer(), 0, sizeof(vcm::Mat4) * 2},
+                    .sampler = {__sampler.GetVkSampler(), VK_NULL_HANDLE, VK_IMAGE_LAYOUT_UNDEFINED},
+                    .texture = {VK_NULL_HANDLE, texture->GetImageView().GetVkImageView(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+                    .objects = {UniformArena::GetVkBuffer(), 0, sizeof(vcm::Mat4)}
+                };
+                __drawSetTemplate.Update(set.GetVkDescriptorSet(), &descriptors);
+                it->second = set.GetVkDescriptorSet();
+            }
+            __drawDescriptorSets.emplace_back(it->second);
+        }
+    }
+
+    // Small draw lists aren't worth dispatching to the workers
+    if (__drawList.size() < MIN_DRAWS_PER_RECORDING_JOB * 2) {
+        __renderPass.BeginRenderPass(&__swapChain, commandBuffer, imageIndex);
+        __BindDrawState(commandBuffer);
+        const GpuScopeId drawScope = commandBuffer->BeginGpuScope("Draws");
+        __RecordDrawRange(commandBuffer, 0, __drawList.size());
+        commandBuffer->EndGpuScope(drawScope);
+        __renderPass.EndRenderPass(commandBuffer);
+        return vc::Error::Success;
+    }
+
+    // Each batch of the draw list is recorded into a secondary command buffer allocated from the per frame pool
+    // of the thread running it (Vulkan pools must be externally synchronized). Batches the workers are too busy
+    // to pick up are recorded by this thread, the frame never waits behind the pool's other jobs
+    const VkCommandBufferInheritanceInfo inheritanceInfo = __renderPass.GetInheritanceInfo(&__swapChain, imageIndex);
+    vc::ThreadPool * threadPool = vc::ThreadPool::GetGlobalThreadPool();
+    __secondaryCommandBuffers.assign(threadPool->GetThreadCount() + 1, nullptr);
+    std::atomic<bool> failed = false;
+    const size_t batchCount = threadPool->ParallelFor(__drawList.size(), MIN_DRAWS_PER_RECORDING_JOB,
+        [&](size_t begin, size_t end, size_t batch) {
+            VENOM_TRACE_ZONE("RecordDrawBatch");
+            CommandPool * pool = CommandPoolManager::GetFrameCommandPool();
+            CommandBuffer * secondary = nullptr;
+            if (pool == nullptr
+                || pool->AcquireCommandBuffer(&secondary, VK_COMMAND_BUFFER_LEVEL_SECONDARY) != vc::Error::Success
+                || secondary->BeginSecondaryCommandBuffer(inheritanceInfo) != vc::Error::Success) {
+                failed = true;
+                return;
+            }
+            __BindDrawState(secondary);
+            const GpuScopeId drawScope = secondary->BeginGpuScope("Draws");
+            __RecordDrawRange(secondary, begin, end);
+            secondary->EndGpuScope(drawScope);
+            if (secondary->EndCommandBuffer() != vc::Error::Success) {
+                failed = true;
+                return;
+            }
+            __secondaryCommandBuffers[batch] = secondary;
+        });
+    if (failed) {
+        vc::Log::Error("Failed to record secondary command buffers");
+        return vc::Error::Failure;
+    }
+    __secondaryCommandBuffers.resize(batchCount);
 
-    __currentFrame = (__currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    __renderPass.BeginRenderPass(&__swapChain, commandBuffer, imageIndex, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    commandBuffer->ExecuteCommands(__secondaryCommandBuffers);
+    __renderPass.EndRenderPass(commandBuffer);
     return vc::Error::Success;
 }
 
@@ -244,6 +496,7 @@ void VulkanApplication::__SetGLFWCallbacks()
     glfwSetFramebufferSizeCallback(__context.GetWindow(), [](GLFWwindow * window, int width, int height) {
         auto app = reinterpret_cast<VulkanApplication*>(glfwGetWindowUserPointer(window));
         app->__framebufferChanged = true;
+        app->__resizeTimer.Reset();
     });
 }
 
@@ -290,12 +543,18 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     // Get Queue Families
     __queueFamilies = getVulkanQueueFamilies(__physicalDevice);
 
-    // Create Surface
-    __surface.CreateSurface(&__context);
+    // Headless: no surface, the "present" queue is only used as a graphics queue
+    const bool headless = __context.IsHeadless();
+    if (headless) {
+        __queueFamilies.presentQueueFamilyIndices = __queueFamilies.graphicsQueueFamilyIndices;
+    } else {
+        // Create Surface
+        __surface.CreateSurface(&__context);
 
-    // Check if the device supports the surface for presentation and which queue family supports it
-    if (err = __queueFamilies.SetPresentQueueFamilyIndices(__physicalDevice, __surface); err != vc::Error::Success)
-        return err;
+        // Check if the device supports the surface for presentation and which queue family supports it
+        if (err = __queueFamilies.SetPresentQueueFamilyIndices(__physicalDevice, __surface); err != vc::Error::Success)
+            return err;
+    }
 
     // Create Logical device
     VkDeviceCreateInfo createInfo{};
@@ -332,16 +591,44 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     deviceFeatures.samplerAnisotropy = VK_TRUE;
     //deviceFeatures.textureCompressionBC = VK_TRUE;
 
-    // Extensions
-    createInfo.enabledExtensionCount = s_deviceExtensions.size();
-    createInfo.ppEnabledExtensionNames = s_deviceExtensions.data();
+    // Vulkan 1.2 features
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    vulkan12Features.timelineSemaphore = VK_TRUE;
+    createInfo.pNext = &vulkan12Features;
+
+    // Bindless textures if the device supports descriptor indexing (core since Vulkan 1.2, older devices are rejected below)
+    bool bindless = false;
+    if (vc::Config::GetInstance()->IsBindlessTexturesEnabled() && __physicalDevice.GetProperties().apiVersion >= VK_API_VERSION_1_2) {
+        VkPhysicalDeviceVulkan12Features supportedVulkan12Features{};
+        supportedVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 supportedFeatures{};
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supportedVulkan12Features;
+        vkGetPhysicalDeviceFeatures2(__physicalDevice.GetVkPhysicalDevice(), &supportedFeatures);
+        bindless = BindlessTextureTable::IsSupported(supportedFeatures.features, supportedVulkan12Features, &deviceFeatures, &vulkan12Features);
+        if (!bindless)
+            vc::Log::Print("Descriptor indexing not supported, textures are bound per descriptor set");
+    }
+
+    // Extensions, headless devices (e.g. lavapipe in CI) don't need to support swap chains
+    std::vector<const char *> deviceExtensions;
+    for (const char * extension : s_deviceExtensions) {
+        if (headless && strcmp(extension, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0)
+            continue;
+        deviceExtensions.emplace_back(extension);
+    }
+    createInfo.enabledExtensionCount = deviceExtensions.size();
+    createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
     // Validation Layers
     _SetCreateInfoValidationLayers(&createInfo);
 
     // Create Swap Chain
-    if (err = __swapChain.InitSwapChainSettings(&__physicalDevice, &__surface, &__context); err != vc::Error::Success)
-        return err;
+    if (!headless) {
+        if (err = __swapChain.InitSwapChainSettings(&__physicalDevice, &__surface, &__context); err != vc::Error::Success)
+            return err;
+    }
 
     // Verify if the device is suitable
     if (!__IsDeviceSuitable(&createInfo))
@@ -354,6 +641,20 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     if (err = __logicalDevice.Init(&createInfo); err != vc::Error::Success)
         return err;
 
+    // Init Device Memory Allocator (sub-allocates buffers & images from big blocks)
+    if (err = __deviceMemoryAllocator.Init(); err != vc::Error::Success)
+        return err;
+
+    // Pipeline cache shared by every pipeline, loaded from the previous run
+    if (err = __pipelineCache.Init(vc::Config::GetInstance()->GetPipelineCacheDirectory()); err != vc::Error::Success)
+        return err;
+
+    // Before any texture gets loaded and registered into it
+    if (bindless) {
+        if (err = __bindlessTextureTable.Init(); err != vc::Error::Success)
+            return err;
+    }
+
     // Init Command Pool Manager (inits 1 pool per queue family)
     if (err = __commandPoolManager.Init(); err != vc::Error::Success)
         return err;
@@ -362,46 +663,57 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     if (err = __queueManager.Init(); err != vc::Error::Success)
         return err;
 
-    // Create SwapChain
-    if (err = __swapChain.InitSwapChain(&__surface, &__context, &__queueFamilies); err != vc::Error::Success)
+    // Init Upload Manager (batches staging copies on the transfer queue)
+    if (err = __uploadManager.Init(vc::Config::GetInstance()->GetStagingBufferSize()); err != vc::Error::Success)
         return err;
 
+    // Create SwapChain, or offscreen images to render to in headless mode
+    if (headless) {
+        const vc::Config * config = vc::Config::GetInstance();
+        if (err = __swapChain.InitOffscreen(config->GetHeadlessWidth(), config->GetHeadlessHeight(), MAX_FRAMES_IN_FLIGHT); err != vc::Error::Success)
+            return err;
+    } else {
+        if (err = __swapChain.InitSwapChain(&__surface, &__context, &__queueFamilies); err != vc::Error::Success)
+            return err;
+    }
+
     // Get Graphics Queue
     __graphicsQueue = QueueManager::GetGraphicsQueue();
 
     // Get Present Queue
     __presentQueue = QueueManager::GetPresentQueue();
 
+    // GPU timestamps of the frames
+    if (err = __gpuProfiler.Init(MAX_FRAMES_IN_FLIGHT, __graphicsQueue); err != vc::Error::Success)
+        return err;
+
     // Create Render Pass
     if (err = __renderPass.InitRenderPass(&__swapChain); err != vc::Error::Success)
         return err;
 
-    // Create Graphics Command Pool
-    CommandPool * graphicsCommandPool = __commandPoolManager.GetGraphicsCommandPool();
+    // Per frame command pools, recycled every time the frame comes back
+    if (err = __commandPoolManager.InitFrameCommandPools(MAX_FRAMES_IN_FLIGHT); err != vc::Error::Success)
+        return err;
+    // Transient descriptor sets, recycled with their frame like the command buffers
+    if (err = __descriptorAllocator.Init(MAX_FRAMES_IN_FLIGHT); err != vc::Error::Success)
+        return err;
+    // Per object uniforms, one region per frame in flight
+    if (err = __uniformArena.Init(UNIFORM_ARENA_FRAME_SIZE, MAX_FRAMES_IN_FLIGHT); err != vc::Error::Success)
+        return err;
 
-    // Create Command Buffers
-    __commandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
-    for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = graphicsCommandPool->CreateCommandBuffer(&__commandBuffers[i]); err != vc::Error::Success)
-            return err;
-    }
+    // Frame timeline & swap chain semaphores
+    if (err = __frameSync.Init(MAX_FRAMES_IN_FLIGHT, !headless); err != vc::Error::Success)
+        return err;
 
-    // Create Semaphores & Fences
-    __imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-    __renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-    __inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
-    for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = __imageAvailableSemaphores[i].InitSemaphore(); err != vc::Error::Success)
-            return err;
-        if (err =__renderFinishedSemaphores[i].InitSemaphore(); err != vc::Error::Success)
-            return err;
-        if (err =__inFlightFences[i].InitFence(VkFenceCreateFlagBits::VK_FENCE_CREATE_SIGNALED_BIT); err != vc::Error::Success)
+    // Readback buffers: one per frame in flight + one being processed before stalling
+    if (headless) {
+        if (err = __readbackManager.Init(__swapChain.extent.width, __swapChain.extent.height, MAX_FRAMES_IN_FLIGHT + 1); err != vc::Error::Success)
             return err;
     }
 
     // Create Uniform Buffers
     for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = __uniformBuffers[i].Init(sizeof(vcm::Mat4) * 3); err != vc::Error::Success)
+        if (err = __uniformBuffers[i].Init(sizeof(vcm::Mat4) * 2); err != vc::Error::Success)
             return err;
     }
 
@@ -410,35 +722,43 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
         return err;
 
     // Test
-    __shaderPipeline.AddVertexBufferToLayout(sizeof(vcm::Vec3), 0, 0, 0, VK_FORMAT_R32G32B32_SFLOAT);
-    __shaderPipeline.AddVertexBufferToLayout(sizeof(vcm::Vec3), 1, 1, 0, VK_FORMAT_R32G32B32_SFLOAT);
-    __shaderPipeline.AddVertexBufferToLayout(sizeof(vcm::Vec4), 2, 2, 0, VK_FORMAT_R32G32B32A32_SFLOAT);
-    __shaderPipeline.AddVertexBufferToLayout(sizeof(vcm::Vec2), 3, 3, 0, VK_FORMAT_R32G32_SFLOAT);
-    __model = reinterpret_cast<VulkanModel*>(vc::Model::Create("eye/eye.obj"));
+    // Object transforms are bound with a dynamic offset into the uniform arena
+    __shaderPipeline.SetDynamicBuffer(0, 3);
+    // Layouts are reflected from the shaders, the pipeline compiles on a worker while the scene loads
+    // The bindless pixel shader samples the bindless table (set 1) at the index pushed per draw
+    if (err = __shaderPipeline.LoadShadersAsync(&__swapChain, &__renderPass, {
+        BindlessTextureTable::IsEnabled() ? "shader_bindless.ps" : "shader.ps",
+        "shader.vs"
+    }); err != vc::Error::Success)
+        return err;
+    __model = reinterpret_cast<VulkanModel*>(vc::Model::Create(vc::Config::GetInstance()->GetSceneModelPath()));
     __mesh = reinterpret_cast<VulkanMesh*>(vc::Mesh::Create());
     __mesh->AddVertexBuffer(__verticesPos, sizeof(__verticesPos) / sizeof(vcm::Vec3), sizeof(vcm::Vec3), 0);
     __mesh->AddVertexBuffer(__verticesPos, sizeof(__verticesPos) / sizeof(vcm::Vec3), sizeof(vcm::Vec3), 1);
     __mesh->AddVertexBuffer(__verticesColor, sizeof(__verticesColor) / sizeof(vcm::Vec4), sizeof(vcm::Vec4), 2);
     __mesh->AddVertexBuffer(__verticesUV, sizeof(__verticesUV) / sizeof(vcm::Vec2), sizeof(vcm::Vec2), 3);
     __mesh->AddIndexBuffer(__indices, sizeof(__indices) / sizeof(uint32_t), sizeof(uint32_t));
-    __shaderPipeline.LoadShaders(&__swapChain, &__renderPass, {
-        "shader.ps",
-        "shader.vs"
-    });
 
     // Create Descriptor Pool
     __descriptorPool.AddPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, MAX_FRAMES_IN_FLIGHT);
     __descriptorPool.AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLER, MAX_FRAMES_IN_FLIGHT);
     __descriptorPool.AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, MAX_FRAMES_IN_FLIGHT);
+    __descriptorPool.AddPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, MAX_FRAMES_IN_FLIGHT);
     //__descriptorPool.AddPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_FRAMES_IN_FLIGHT);
     if (err = __descriptorPool.Create(0, MAX_FRAMES_IN_FLIGHT); err != vc::Error::Success)
         return err;
 
-    // Create Descriptor Sets
+    // Create Descriptor Sets, written once the texture is loaded
     __descriptorSets = __descriptorPool.AllocateSets(__shaderPipeline.GetDescriptorSetLayout(), MAX_FRAMES_IN_FLIGHT);
-    for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
-        // Model, View, Projection
-        __descriptorSets[i].UpdateBuffer(__uniformBuffers[i], 0, sizeof(vcm::Mat4) * 3, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 0);
+
+    // Per texture sets are all written the same way
+    if (!BindlessTextureTable::IsEnabled()) {
+        __drawSetTemplate.AddEntry(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, offsetof(DrawSetDescriptors, uniforms));
+        __drawSetTemplate.AddEntry(1, VK_DESCRIPTOR_TYPE_SAMPLER, offsetof(DrawSetDescriptors, sampler));
+        __drawSetTemplate.AddEntry(2, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, offsetof(DrawSetDescriptors, texture));
+        __drawSetTemplate.AddEntry(3, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, offsetof(DrawSetDescriptors, objects));
+        if (err = __drawSetTemplate.Create(__shaderPipeline.GetDescriptorSetLayout()); err != vc::Error::Success)
+            return err;
     }
 
     // Create Sampler
@@ -492,7 +812,7 @@ bool VulkanApplication::__IsDeviceSuitable(const VkDeviceCreateInfo * createInfo
     }
 
     // Check if the device's swap chain is ok
-    if (__swapChain.presentModes.empty() || __swapChain.surfaceFormats.empty()) {
+    if (!__context.IsHeadless() && (__swapChain.presentModes.empty() || __swapChain.surfaceFormats.empty())) {
         vc::Log::Error("Failed to get surface formats or present modes for swap chain");
         return false;
     }
@@ -502,6 +822,22 @@ bool VulkanApplication::__IsDeviceSuitable(const VkDeviceCreateInfo * createInfo
         vc::Log::Error("Device does not support anisotropy");
         return false;
     }
+
+    // Check if the device supports Vulkan 1.2 & timeline semaphores (frame pacing, uploads)
+    if (__physicalDevice.GetProperties().apiVersion < VK_API_VERSION_1_2) {
+        vc::Log::Error("Device does not support Vulkan 1.2");
+        return false;
+    }
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    VkPhysicalDeviceFeatures2 features2{};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &vulkan12Features;
+    vkGetPhysicalDeviceFeatures2(__physicalDevice.GetVkPhysicalDevice(), &features2);
+    if (vulkan12Features.timelineSemaphore != VK_TRUE) {
+        vc::Log::Error("Device does not support timeline semaphores");
+        return false;
+    }
     return true;
 }
 
@@ -520,14 +856,25 @@ vc::Error VulkanApplication::__CreateInstance()
     return vc::Error::Success;
 }
 
-void VulkanApplication::__RecreateSwapChain()
+vc::Error VulkanApplication::__RecreateSwapChain()
 {
-    vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
-    __swapChain.InitSwapChainSettings(&__physicalDevice, &__surface, &__context);
-    __swapChain.InitSwapChain(&__surface, &__context, &__queueFamilies);
-    __swapChain.InitSwapChainFramebuffers(&__renderPass);
+    vc::Error err;
+    if (err = __swapChain.InitSwapChainSettings(&__physicalDevice, &__surface, &__context); err != vc::Error::Success)
+        return err;
+    // Minimized: keep the flag until the window comes back
+    if (__swapChain.extent.width == 0 || __swapChain.extent.height == 0) {
+        __framebufferChanged = true;
+        return vc::Error::Success;
+    }
+    __framebufferChanged = false;
+    vc::Log::Print("Recreating swap chain");
 
-    // We also need to reset the last used semaphore
-    __imageAvailableSemaphores[__currentFrame].InitSemaphore();
+    // No device idle: the old swap chain is handed over to the new one, its images, framebuffers
+    // and the old depth texture are retired through the deletion queue once the frames using them are done
+    if (err = __swapChain.InitSwapChain(&__surface, &__context, &__queueFamilies); err != vc::Error::Success)
+        return err;
+    if (err = __swapChain.InitSwapChainFramebuffers(&__renderPass); err != vc::Error::Success)
+        return err;
+    return vc::Error::Success;
 }
 }
@@ -1,11 +1,15 @@
 // HLSL Vertex Shader for Vulkan using DXC
 
 cbuffer UniformBufferObject : register(b0) {
-    float4x4 model;
     float4x4 view;
     float4x4 proj;
 };
 
+// Per object, bound with a dynamic offset into the frame's uniform arena
+cbuffer ObjectBufferObject : register(b3) {
+    float4x4 model;
+};
+
 // struct C
 // {
 //     float4x4 model;
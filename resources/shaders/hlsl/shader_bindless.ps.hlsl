@@ -0,0 +1,19 @@
+struct PSInput {
+    [[vk::location(0)]] float4 color : COLOR;
+    [[vk::location(1)]] float2 texCoord : TEXCOORD;
+};
+
+// Per draw: index of the material's texture in the bindless texture table
+struct DrawConstants {
+    uint textureIndex;
+};
+[[vk::push_constant]] DrawConstants g_draw;
+
+SamplerState g_sampler : register(s1);
+// Bindless texture table, alone in set 1
+Texture2D g_textures[] : register(t0, space1);
+
+float4 main(PSInput input) : SV_TARGET {
+    // Same index for the whole draw, no NonUniformResourceIndex needed
+    return float4(g_textures[g_draw.textureIndex].Sample(g_sampler, input.texCoord));
+}
@@ -0,0 +1,33 @@
+"""Bakes models & textures at build time with //tools:venom_bake."""
+
+def _venom_baked_assets_impl(ctx):
+    output = ctx.actions.declare_directory(ctx.label.name)
+    args = ctx.actions.args()
+    args.add("--output=" + output.path)
+    args.add_all(ctx.files.srcs)
+    ctx.actions.run(
+        outputs = [output],
+        inputs = ctx.files.srcs,
+        executable = ctx.executable._tool,
+        arguments = [args],
+        mnemonic = "VenomBake",
+        progress_message = "Baking assets for %{label}",
+    )
+    return [DefaultInfo(
+        files = depset([output]),
+        runfiles = ctx.runfiles(files = [output]),
+    )]
+
+# Directory named after the target, holding the baked copy of every model & texture of srcs.
+# Matches the engine's default baked asset directory when named "baked" in the root package.
+venom_baked_assets = rule(
+    implementation = _venom_baked_assets_impl,
+    attrs = {
+        "srcs": attr.label_list(allow_files = True),
+        "_tool": attr.label(
+            default = Label("//tools:venom_bake"),
+            executable = True,
+            cfg = "exec",
+        ),
+    },
+)
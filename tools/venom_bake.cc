@@ -0,0 +1,181 @@
+///
+/// Project: VenomEngine
+/// @file venom_bake.cc
+/// @date Oct, 16 2026
+/// @brief Bakes models and textures offline to the formats the engine maps at load time, without any Graphics API.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/BakedAsset.h>
+#include <venom/common/Config.h>
+#include <venom/common/Log.h>
+#include <venom/common/ThreadPool.h>
+#include <venom/common/plugin/graphics/BakedModel.h>
+#include <venom/common/plugin/graphics/Model.h>
+#include <venom/common/plugin/graphics/Texture.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <vector>
+
+struct BakeSettings
+{
+    std::string outputDirectory;
+    // Rebakes even if an up to date bake exists
+    bool force = false;
+    std::vector<std::string> inputs;
+};
+
+enum class AssetType
+{
+    None,
+    Model,
+    Texture
+};
+
+static bool ParseArguments(int argc, char** argv, BakeSettings & settings)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char * arg = argv[i];
+        if (strncmp(arg, "--output=", 9) == 0) {
+            settings.outputDirectory = arg + 9;
+        } else if (strcmp(arg, "--force") == 0) {
+            settings.force = true;
+        } else if (strcmp(arg, "--mesh-optimization=none") == 0) {
+            vc::Config::GetInstance()->SetMeshOptimization(vc::Config::MeshOptimization::None);
+        } else if (strcmp(arg, "--mesh-optimization=cache") == 0) {
+            vc::Config::GetInstance()->SetMeshOptimization(vc::Config::MeshOptimization::VertexCache);
+        } else if (strcmp(arg, "--mesh-optimization=overdraw") == 0) {
+            vc::Config::GetInstance()->SetMeshOptimization(vc::Config::MeshOptimization::Overdraw);
+        } else if (strncmp(arg, "--", 2) == 0) {
+            vc::Log::Error("Unknown argument: %s", arg);
+            vc::Log::Error("Usage: venom_bake --output=dir [--force] [--mesh-optimization=none|cache|overdraw] <files or directories...>");
+            return false;
+        } else {
+            settings.inputs.emplace_back(arg);
+        }
+    }
+    if (settings.outputDirectory.empty() || settings.inputs.empty()) {
+        vc::Log::Error("Usage: venom_bake --output=dir [--force] [--mesh-optimization=none|cache|overdraw] <files or directories...>");
+        return false;
+    }
+    return true;
+}
+
+static AssetType GetAssetType(const std::filesystem::path & path)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+    static const char * modelExtensions[] = {".obj", ".fbx", ".gltf", ".glb", ".dae", ".3ds", ".blend"};
+    static const char * textureExtensions[] = {".png", ".jpg", ".jpeg", ".tga", ".bmp", ".hdr"};
+    for (const char * ext : modelExtensions)
+        if (extension == ext) return AssetType::Model;
+    for (const char * ext : textureExtensions)
+        if (extension == ext) return AssetType::Texture;
+    return AssetType::None;
+}
+
+static void CollectAssets(const std::string & input, std::vector<std::filesystem::path> & models, std::vector<std::filesystem::path> & textures)
+{
+    std::error_code ec;
+    std::vector<std::filesystem::path> files;
+    if (std::filesystem::is_directory(input, ec)) {
+        for (const auto & entry : std::filesystem::recursive_directory_iterator(input, ec))
+            if (entry.is_regular_file()) files.emplace_back(entry.path());
+    } else {
+        files.emplace_back(input);
+    }
+    for (const std::filesystem::path & file : files) {
+        switch (GetAssetType(file)) {
+            case AssetType::Model: models.emplace_back(file); break;
+            case AssetType::Texture: textures.emplace_back(file); break;
+            default: break;
+        }
+    }
+}
+
+/// @return false on failure, skipped is set if the bake was already up to date
+static bool BakeAsset(const std::filesystem::path & source, const AssetType type, const BakeSettings & settings, bool & skipped)
+{
+    const std::string sourcePath = source.string();
+    uint64_t sourceHash;
+    if (vc::BakedAsset::HashFile(sourcePath, sourceHash) != vc::Error::Success)
+        return false;
+    const char * extension = type == AssetType::Model ? vc::BAKED_MODEL_EXTENSION : vc::BAKED_TEXTURE_EXTENSION;
+    const std::string bakedPath = (std::filesystem::path(settings.outputDirectory)
+        / vc::BakedAsset::GetBakedFileName(sourcePath, sourceHash, extension)).string();
+
+    // Existing bakes are checked like at load time: format version, source hash and, for models, dependencies
+    skipped = false;
+    if (!settings.force && std::filesystem::exists(bakedPath)) {
+        vc::Error err;
+        if (type == AssetType::Model) {
+            vc::BakedModel baked;
+            err = baked.Open(bakedPath, sourcePath, sourceHash);
+        } else {
+            vc::DecodedImage baked;
+            err = vc::Texture::OpenBakedImage(bakedPath, sourceHash, baked);
+        }
+        if (err == vc::Error::Success) {
+            skipped = true;
+            return true;
+        }
+    }
+    if (type == AssetType::Model)
+        return vc::Model::BakeModel(sourcePath, bakedPath, sourceHash) == vc::Error::Success;
+    return vc::Texture::BakeImageFile(sourcePath, bakedPath, sourceHash) == vc::Error::Success;
+}
+
+int main(int argc, char** argv)
+{
+    BakeSettings settings;
+    if (!ParseArguments(argc, argv, settings))
+        return 1;
+
+    std::vector<std::filesystem::path> models;
+    std::vector<std::filesystem::path> textures;
+    for (const std::string & input : settings.inputs)
+        CollectAssets(input, models, textures);
+
+    std::error_code ec;
+    std::filesystem::create_directories(settings.outputDirectory, ec);
+    if (ec) {
+        vc::Log::Error("Failed to create output directory %s: %s", settings.outputDirectory.c_str(), ec.message().c_str());
+        return 1;
+    }
+
+    std::atomic<uint32_t> bakedCount = 0;
+    std::atomic<uint32_t> skippedCount = 0;
+    std::atomic<uint32_t> failedCount = 0;
+    auto bake = [&](const std::filesystem::path & source, const AssetType type) {
+        bool skipped;
+        if (!BakeAsset(source, type, settings, skipped)) {
+            vc::Log::Error("Failed to bake %s", source.string().c_str());
+            ++failedCount;
+        } else if (skipped) {
+            ++skippedCount;
+        } else {
+            vc::Log::Print("Baked %s", source.string().c_str());
+            ++bakedCount;
+        }
+    };
+
+    // Textures are independent jobs
+    vc::ThreadPool * pool = vc::ThreadPool::GetGlobalThreadPool();
+    std::vector<std::future<void>> textureJobs;
+    textureJobs.reserve(textures.size());
+    for (const std::filesystem::path & texture : textures)
+        textureJobs.emplace_back(pool->Submit([&bake, &texture]() { bake(texture, AssetType::Texture); }));
+    // Models already split their meshes over the pool with ParallelFor, which mustn't be nested in a job
+    for (const std::filesystem::path & model : models)
+        bake(model, AssetType::Model);
+    for (std::future<void> & job : textureJobs)
+        job.wait();
+
+    vc::Log::Print("venom_bake: %u baked, %u up to date, %u failed", bakedCount.load(), skippedCount.load(), failedCount.load());
+    return failedCount == 0 ? 0 : 1;
+}